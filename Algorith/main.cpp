@@ -19,7 +19,28 @@
 #include <numeric>
 #include <iomanip>
 #include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <deque>
+#include <array>
+#include <utility>
+#include <memory>
 #include <ctime>
+#include <cstring>
+#include <cstdint>
+#include <cstdio>
+#include <charconv>
+#include <string_view>
+
+//   : AVX2   target,    CPUID
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define SIMD_SORT_AVAILABLE 1
+#define AVX2_TARGET __attribute__((target("avx2")))
+#else
+#define SIMD_SORT_AVAILABLE 0
+#endif
+
 using namespace std;
 
 //     string  wstring
@@ -38,16 +59,31 @@ struct OperationCounts {
     long long comparisons = 0;      //  
     long long swaps = 0;            //  
     long long memory_access = 0;    //    
+    long long passes = 0;           //     ( )
+    long long char_inspections = 0; //    ( )
     size_t extra_memory = 0;        //    
     size_t current_memory = 0;      //   
     vector<int> accessed_indices;   //    (  )
+    vector<pair<string, double>> phase_times; //     ()
 
     //  
     void reset() {
-        comparisons = swaps = memory_access = 0;
+        comparisons = swaps = memory_access = passes = char_inspections = 0;
         extra_memory = current_memory = 0;
         accessed_indices.clear();
         accessed_indices.shrink_to_fit();
+        phase_times.clear();
+    }
+
+    //    (  )
+    void add_phase_time(const string& phase, double seconds) {
+        for (auto& entry : phase_times) {
+            if (entry.first == phase) {
+                entry.second += seconds;
+                return;
+            }
+        }
+        phase_times.emplace_back(phase, seconds);
     }
 
     //    
@@ -75,6 +111,11 @@ struct OperationCounts {
         comparisons += other.comparisons;
         swaps += other.swaps;
         memory_access += other.memory_access;
+        passes += other.passes;
+        char_inspections += other.char_inspections;
+        for (const auto& entry : other.phase_times) {
+            add_phase_time(entry.first, entry.second);
+        }
         if (other.extra_memory > extra_memory) {
             extra_memory = other.extra_memory;
         }
@@ -101,6 +142,8 @@ struct StatisticalResults {
     double confidence_interval;    //  
     vector<double> all_measurements; //  
 
+    StatisticalResults() : mean_time(0.0), std_dev(0.0), min_time(0.0), max_time(0.0), confidence_interval(0.0) {}
+
     //  
     void calculate() {
         if (all_measurements.empty()) return;
@@ -134,6 +177,9 @@ struct AlgorithmResult {
     string complexity;             //  
     vector<double> times_by_size;  //    
     OperationCounts avg_operations; //  
+    bool has_argsort = false;      //   
+    double argsort_time = 0;       //    
+    double gather_time = 0;        //    
 
     AlgorithmResult(const string& n) : name(n), cache_efficiency(0), stable(false) {}
 
@@ -150,10 +196,76 @@ struct AlgorithmResult {
         avg_operations.comparisons /= metrics.size();
         avg_operations.swaps /= metrics.size();
         avg_operations.memory_access /= metrics.size();
+        avg_operations.passes /= metrics.size();
+        avg_operations.char_inspections /= metrics.size();
         avg_operations.extra_memory /= metrics.size();
     }
 };
 
+//      
+struct ScalingResult {
+    string name;                   //  
+    int array_size = 0;            //  
+    vector<int> thread_counts;     //  
+    vector<double> times;          //     
+    vector<double> speedups;       //    
+    vector<string> phase_names;    //   (   )
+    vector<vector<double>> phase_times; //       
+};
+
+//      
+struct ExternalSortResult {
+    string distribution;           //   
+    long long elements = 0;        //  
+    size_t memory_limit = 0;       //   ()
+    int runs = 0;                  //   
+    int merge_passes = 0;          //   
+    long long bytes_read = 0;      //  
+    long long bytes_written = 0;   //  
+    double io_time = 0;            //  - ()
+    double cpu_time = 0;           //   ()
+    double total_time = 0;         //   ()
+};
+
+//        k   
+struct SelectionResult {
+    string name;                   //  
+    string distribution;           //  
+    int array_size = 0;            //  
+    vector<double> k_fractions;    //  k / n
+    vector<double> times;          //    
+};
+
+//  k-         k
+struct KWayMergeResult {
+    string name;                   //  
+    int run_length = 0;            //   
+    vector<int> fan_ins;           //   k
+    vector<double> times;          //     k
+    vector<double> comparisons;    //      k
+};
+
+//     (n = 2..32)     
+struct SmallSortResult {
+    string name;                   //  
+    string distribution;           //  
+    vector<int> sizes;             //  
+    vector<double> times;          //       
+};
+
+//          
+struct PresortednessResult {
+    string distribution;           //  
+    int array_size = 0;            //  
+    double probe_time = 0;         //   
+    double sort_time = 0;          //   Introsort   
+    double accuracy = 0;           //  ,     
+    double descending_ratio = 0;   //   
+    double inversion_ratio = 0;
+    double duplicate_ratio = 0;
+    double estimated_runs = 0;
+};
+
 //     
 struct DataTypeAnalysis {
     string type_name;              //   
@@ -161,6 +273,12 @@ struct DataTypeAnalysis {
     map<string, double> best_times; //    
     vector<int> test_sizes;        //  
     map<string, vector<AlgorithmResult>> algorithms_by_distribution; //   
+    vector<ScalingResult> scaling; //   
+    vector<ExternalSortResult> external; //   ( )
+    vector<SelectionResult> selection; //  k    
+    vector<PresortednessResult> presortedness; //   
+    vector<SmallSortResult> small_sizes; //  :    
+    vector<KWayMergeResult> kway_merge; // k-   
 
     //     
     vector<AlgorithmResult> getAlgorithmsForDistribution(const string& distribution) const {
@@ -179,6 +297,8 @@ struct SavedOperationCounts {
     long long comparisons = 0;
     long long swaps = 0;
     long long memory_access = 0;
+    long long passes = 0;
+    long long char_inspections = 0;
     size_t extra_memory = 0;
 };
 
@@ -199,6 +319,9 @@ struct SavedAlgorithmResult {
     string complexity;
     vector<double> times_by_size;
     SavedOperationCounts avg_operations;
+    bool has_argsort = false;
+    double argsort_time = 0;
+    double gather_time = 0;
 };
 
 struct SavedDataTypeAnalysis {
@@ -207,6 +330,12 @@ struct SavedDataTypeAnalysis {
     map<string, double> best_times;
     vector<int> test_sizes;
     map<string, vector<SavedAlgorithmResult>> algorithms_by_distribution;
+    vector<ScalingResult> scaling;
+    vector<ExternalSortResult> external;
+    vector<SelectionResult> selection;
+    vector<PresortednessResult> presortedness;
+    vector<SmallSortResult> small_sizes;
+    vector<KWayMergeResult> kway_merge;
 };
 
 //    
@@ -278,6 +407,10 @@ struct AnalysisSession {
                 file << "          \"cache_efficiency\": " << algo.cache_efficiency << ",\n";
                 file << "          \"stable\": " << (algo.stable ? "true" : "false") << ",\n";
                 file << "          \"complexity\": \"" << algo.complexity << "\",\n";
+                if (algo.has_argsort) {
+                    file << "          \"argsort_time\": " << algo.argsort_time << ",\n";
+                    file << "          \"gather_time\": " << algo.gather_time << ",\n";
+                }
 
                 // 
                 file << "          \"stats\": {\n";
@@ -301,6 +434,8 @@ struct AnalysisSession {
                 file << "            \"comparisons\": " << algo.avg_operations.comparisons << ",\n";
                 file << "            \"swaps\": " << algo.avg_operations.swaps << ",\n";
                 file << "            \"memory_access\": " << algo.avg_operations.memory_access << ",\n";
+                file << "            \"passes\": " << algo.avg_operations.passes << ",\n";
+                file << "            \"char_inspections\": " << algo.avg_operations.char_inspections << ",\n";
                 file << "            \"extra_memory\": " << algo.avg_operations.extra_memory << "\n";
                 file << "          }\n";
 
@@ -322,6 +457,10 @@ struct AnalysisSession {
                     file << "            \"cache_efficiency\": " << algo.cache_efficiency << ",\n";
                     file << "            \"stable\": " << (algo.stable ? "true" : "false") << ",\n";
                     file << "            \"complexity\": \"" << algo.complexity << "\",\n";
+                    if (algo.has_argsort) {
+                        file << "            \"argsort_time\": " << algo.argsort_time << ",\n";
+                        file << "            \"gather_time\": " << algo.gather_time << ",\n";
+                    }
 
                     file << "            \"stats\": {\n";
                     file << "              \"mean_time\": " << algo.stats.mean_time << ",\n";
@@ -342,6 +481,8 @@ struct AnalysisSession {
                     file << "              \"comparisons\": " << algo.avg_operations.comparisons << ",\n";
                     file << "              \"swaps\": " << algo.avg_operations.swaps << ",\n";
                     file << "              \"memory_access\": " << algo.avg_operations.memory_access << ",\n";
+                    file << "              \"passes\": " << algo.avg_operations.passes << ",\n";
+                    file << "              \"char_inspections\": " << algo.avg_operations.char_inspections << ",\n";
                     file << "              \"extra_memory\": " << algo.avg_operations.extra_memory << "\n";
                     file << "            }\n";
 
@@ -353,7 +494,176 @@ struct AnalysisSession {
                 if (++dist_count < data_type.algorithms_by_distribution.size()) file << ",\n";
                 else file << "\n";
             }
-            file << "      }\n";
+            file << "      },\n";
+
+            //   
+            file << "      \"scaling\": [\n";
+            for (size_t scale_idx = 0; scale_idx < data_type.scaling.size(); scale_idx++) {
+                const auto& scale = data_type.scaling[scale_idx];
+                file << "        {\n";
+                file << "          \"name\": \"" << scale.name << "\",\n";
+                file << "          \"array_size\": " << scale.array_size << ",\n";
+                file << "          \"thread_counts\": [";
+                for (size_t i = 0; i < scale.thread_counts.size(); i++) {
+                    file << scale.thread_counts[i];
+                    if (i < scale.thread_counts.size() - 1) file << ", ";
+                }
+                file << "],\n";
+                file << "          \"times\": [";
+                for (size_t i = 0; i < scale.times.size(); i++) {
+                    file << scale.times[i];
+                    if (i < scale.times.size() - 1) file << ", ";
+                }
+                file << "],\n";
+                file << "          \"speedups\": [";
+                for (size_t i = 0; i < scale.speedups.size(); i++) {
+                    file << scale.speedups[i];
+                    if (i < scale.speedups.size() - 1) file << ", ";
+                }
+                file << "]";
+                if (!scale.phase_names.empty()) {
+                    file << ",\n          \"phases\": {\n";
+                    for (size_t phase = 0; phase < scale.phase_names.size(); phase++) {
+                        file << "            \"" << scale.phase_names[phase] << "\": [";
+                        for (size_t i = 0; i < scale.phase_times[phase].size(); i++) {
+                            file << scale.phase_times[phase][i];
+                            if (i < scale.phase_times[phase].size() - 1) file << ", ";
+                        }
+                        file << "]";
+                        if (phase < scale.phase_names.size() - 1) file << ",";
+                        file << "\n";
+                    }
+                    file << "          }";
+                }
+                file << "\n";
+                file << "        }";
+                if (scale_idx < data_type.scaling.size() - 1) file << ",";
+                file << "\n";
+            }
+            file << "      ],\n";
+
+            //  : -   
+            file << "      \"external\": [\n";
+            for (size_t ext_idx = 0; ext_idx < data_type.external.size(); ext_idx++) {
+                const auto& ext = data_type.external[ext_idx];
+                file << "        {\n";
+                file << "          \"distribution\": \"" << ext.distribution << "\",\n";
+                file << "          \"elements\": " << ext.elements << ",\n";
+                file << "          \"memory_limit\": " << ext.memory_limit << ",\n";
+                file << "          \"runs\": " << ext.runs << ",\n";
+                file << "          \"merge_passes\": " << ext.merge_passes << ",\n";
+                file << "          \"bytes_read\": " << ext.bytes_read << ",\n";
+                file << "          \"bytes_written\": " << ext.bytes_written << ",\n";
+                file << "          \"io_time\": " << ext.io_time << ",\n";
+                file << "          \"cpu_time\": " << ext.cpu_time << ",\n";
+                file << "          \"total_time\": " << ext.total_time << "\n";
+                file << "        }";
+                if (ext_idx < data_type.external.size() - 1) file << ",";
+                file << "\n";
+            }
+            file << "      ],\n";
+
+            //  k    k
+            file << "      \"selection\": [\n";
+            for (size_t sel_idx = 0; sel_idx < data_type.selection.size(); sel_idx++) {
+                const auto& sel = data_type.selection[sel_idx];
+                file << "        {\n";
+                file << "          \"name\": \"" << sel.name << "\",\n";
+                file << "          \"distribution\": \"" << sel.distribution << "\",\n";
+                file << "          \"array_size\": " << sel.array_size << ",\n";
+                file << "          \"k_fractions\": [";
+                for (size_t i = 0; i < sel.k_fractions.size(); i++) {
+                    file << sel.k_fractions[i];
+                    if (i < sel.k_fractions.size() - 1) file << ", ";
+                }
+                file << "],\n";
+                file << "          \"times\": [";
+                for (size_t i = 0; i < sel.times.size(); i++) {
+                    file << sel.times[i];
+                    if (i < sel.times.size() - 1) file << ", ";
+                }
+                file << "]\n";
+                file << "        }";
+                if (sel_idx < data_type.selection.size() - 1) file << ",";
+                file << "\n";
+            }
+            file << "      ],\n";
+
+            //  :      
+            file << "      \"presortedness\": [\n";
+            for (size_t probe_idx = 0; probe_idx < data_type.presortedness.size(); probe_idx++) {
+                const auto& probe = data_type.presortedness[probe_idx];
+                file << "        {\n";
+                file << "          \"distribution\": \"" << probe.distribution << "\",\n";
+                file << "          \"array_size\": " << probe.array_size << ",\n";
+                file << "          \"probe_time\": " << probe.probe_time << ",\n";
+                file << "          \"sort_time\": " << probe.sort_time << ",\n";
+                file << "          \"accuracy\": " << probe.accuracy << ",\n";
+                file << "          \"descending_ratio\": " << probe.descending_ratio << ",\n";
+                file << "          \"inversion_ratio\": " << probe.inversion_ratio << ",\n";
+                file << "          \"duplicate_ratio\": " << probe.duplicate_ratio << ",\n";
+                file << "          \"estimated_runs\": " << probe.estimated_runs << "\n";
+                file << "        }";
+                if (probe_idx < data_type.presortedness.size() - 1) file << ",";
+                file << "\n";
+            }
+            file << "      ],\n";
+
+            //   n = 2..32
+            file << "      \"small_sizes\": [\n";
+            for (size_t small_idx = 0; small_idx < data_type.small_sizes.size(); small_idx++) {
+                const auto& small = data_type.small_sizes[small_idx];
+                file << "        {\n";
+                file << "          \"name\": \"" << small.name << "\",\n";
+                file << "          \"distribution\": \"" << small.distribution << "\",\n";
+                file << "          \"sizes\": [";
+                for (size_t i = 0; i < small.sizes.size(); i++) {
+                    file << small.sizes[i];
+                    if (i < small.sizes.size() - 1) file << ", ";
+                }
+                file << "],\n";
+                file << "          \"times\": [";
+                for (size_t i = 0; i < small.times.size(); i++) {
+                    file << small.times[i];
+                    if (i < small.times.size() - 1) file << ", ";
+                }
+                file << "]\n";
+                file << "        }";
+                if (small_idx < data_type.small_sizes.size() - 1) file << ",";
+                file << "\n";
+            }
+            file << "      ],\n";
+
+            // k- 
+            file << "      \"kway_merge\": [\n";
+            for (size_t merge_idx = 0; merge_idx < data_type.kway_merge.size(); merge_idx++) {
+                const auto& merge = data_type.kway_merge[merge_idx];
+                file << "        {\n";
+                file << "          \"name\": \"" << merge.name << "\",\n";
+                file << "          \"run_length\": " << merge.run_length << ",\n";
+                file << "          \"fan_ins\": [";
+                for (size_t i = 0; i < merge.fan_ins.size(); i++) {
+                    file << merge.fan_ins[i];
+                    if (i < merge.fan_ins.size() - 1) file << ", ";
+                }
+                file << "],\n";
+                file << "          \"times\": [";
+                for (size_t i = 0; i < merge.times.size(); i++) {
+                    file << merge.times[i];
+                    if (i < merge.times.size() - 1) file << ", ";
+                }
+                file << "],\n";
+                file << "          \"comparisons\": [";
+                for (size_t i = 0; i < merge.comparisons.size(); i++) {
+                    file << merge.comparisons[i];
+                    if (i < merge.comparisons.size() - 1) file << ", ";
+                }
+                file << "]\n";
+                file << "        }";
+                if (merge_idx < data_type.kway_merge.size() - 1) file << ",";
+                file << "\n";
+            }
+            file << "      ]\n";
 
             file << "    }";
             if (data_idx < results.size() - 1) file << ",";
@@ -378,6 +688,8 @@ public:
         saved.comparisons = ops.comparisons;
         saved.swaps = ops.swaps;
         saved.memory_access = ops.memory_access;
+        saved.passes = ops.passes;
+        saved.char_inspections = ops.char_inspections;
         saved.extra_memory = ops.extra_memory;
         return saved;
     }
@@ -402,6 +714,9 @@ public:
         saved.complexity = algo.complexity;
         saved.times_by_size = algo.times_by_size;
         saved.avg_operations = convert(algo.avg_operations);
+        saved.has_argsort = algo.has_argsort;
+        saved.argsort_time = algo.argsort_time;
+        saved.gather_time = algo.gather_time;
         return saved;
     }
 
@@ -425,6 +740,13 @@ public:
             saved.algorithms_by_distribution[dist] = saved_algos;
         }
 
+        saved.scaling = analysis.scaling;
+        saved.external = analysis.external;
+        saved.selection = analysis.selection;
+        saved.presortedness = analysis.presortedness;
+        saved.small_sizes = analysis.small_sizes;
+        saved.kway_merge = analysis.kway_merge;
+
         return saved;
     }
 
@@ -549,9 +871,9 @@ void selection_sort_instrumented(T arr[], int n, OperationCounts& ops) {
     ops.remove_memory(sizeof(int) * 3);
 }
 
-//  
+//       ( ,   )
 template<typename T>
-void insertion_sort_instrumented(T arr[], int n, OperationCounts& ops) {
+void linear_insertion_sort_instrumented(T arr[], int n, OperationCounts& ops) {
     ops.add_memory(sizeof(T) + sizeof(int) * 2);
 
     for (int i = 1; i < n; i++) {
@@ -585,6 +907,333 @@ void insertion_sort_instrumented(T arr[], int n, OperationCounts& ops) {
     ops.remove_memory(sizeof(T) + sizeof(int) * 2);
 }
 
+//  arr[from..to)    : memmove    
+template<typename T>
+void shift_right_by_one(T arr[], int from, int to) {
+    if constexpr (is_trivially_copyable_v<T>) {
+        memmove(static_cast<void*>(arr + from + 1), static_cast<const void*>(arr + from), sizeof(T) * (to - from));
+    } else {
+        for (int i = to; i > from; i--) {
+            arr[i] = move(arr[i - 1]);
+        }
+    }
+}
+
+//    arr[low..high),  arr[low..start)  .
+//   -   (),    memmove,  
+template<typename T>
+void binary_insertion_sort_instrumented(T arr[], int low, int high, int start, OperationCounts& ops) {
+    if (start == low) start++;
+
+    for (; start < high; start++) {
+        T pivot = move(arr[start]);
+        int left = low;
+        int right = start;
+
+        while (left < right) {
+            int mid = left + (right - left) / 2;
+            ops.comparisons++;
+            ops.memory_access++;
+            if (pivot < arr[mid]) right = mid;
+            else left = mid + 1;
+        }
+
+        shift_right_by_one(arr, left, start);
+        arr[left] = move(pivot);
+        ops.swaps += start - left;
+        ops.memory_access += 2LL * (start - left) + 2;
+    }
+}
+
+//    :  (  )   ,
+//        . 
+template<typename T>
+void sentinel_insertion_sort_instrumented(T arr[], int n, OperationCounts& ops) {
+    if (n < 2) return;
+
+    int min_index = 0;
+    for (int i = 1; i < n; i++) {
+        ops.comparisons++;
+        if (arr[i] < arr[min_index]) min_index = i;
+    }
+    ops.memory_access += n;
+
+    if (min_index > 0) {
+        T minimum = move(arr[min_index]);
+        shift_right_by_one(arr, 0, min_index);
+        arr[0] = move(minimum);
+        ops.swaps += min_index;
+        ops.memory_access += 2LL * min_index + 2;
+    }
+
+    for (int i = 2; i < n; i++) {
+        T key = move(arr[i]);
+        int j = i - 1;
+        if (ops.accessed_indices.size() < 10000) {
+            ops.accessed_indices.push_back(i);
+        }
+
+        ops.comparisons++;
+        while (key < arr[j]) {
+            arr[j + 1] = move(arr[j]);
+            j--;
+            ops.comparisons++;
+            ops.swaps++;
+            ops.memory_access += 2;
+        }
+        arr[j + 1] = move(key);
+        ops.memory_access += 2;
+    }
+}
+
+// ,           
+const int INSERTION_LINEAR_MAX = 32;
+
+//  :     -     
+//     memmove  ,  -    
+template<typename T>
+void insertion_sort_instrumented(T arr[], int n, OperationCounts& ops) {
+    if constexpr (is_trivially_copyable_v<T>) {
+        ops.add_memory(sizeof(T) + sizeof(int) * 3);
+        if (n <= INSERTION_LINEAR_MAX) {
+            sentinel_insertion_sort_instrumented(arr, n, ops);
+        } else {
+            binary_insertion_sort_instrumented(arr, 0, n, 0, ops);
+        }
+        ops.remove_memory(sizeof(T) + sizeof(int) * 3);
+    } else {
+        linear_insertion_sort_instrumented(arr, n, ops);
+    }
+}
+
+//   ,    
+const int SORTING_NETWORK_MAX = 32;
+
+//    (- )  n    ,
+//    n: visit(i, j)    i < j   
+template<typename Visit>
+constexpr void batcher_network(size_t n, Visit visit) {
+    for (size_t p = 1; p < n; p <<= 1) {
+        for (size_t k = p; k >= 1; k >>= 1) {
+            for (size_t j = k % p; j + k < n; j += 2 * k) {
+                for (size_t i = 0; i < min(k, n - j - k); i++) {
+                    if ((i + j) / (2 * p) == (i + j + k) / (2 * p)) {
+                        visit(i + j, i + j + k);
+                    }
+                }
+            }
+        }
+    }
+}
+
+//   N ,   
+template<size_t N>
+struct SortingNetwork {
+    static constexpr size_t size() {
+        size_t count = 0;
+        batcher_network(N, [&count](size_t, size_t) { count++; });
+        return count;
+    }
+
+    struct Comparators {
+        uint8_t low[size() + 1];
+        uint8_t high[size() + 1];
+    };
+
+    static constexpr Comparators build() {
+        Comparators comparators{};
+        size_t count = 0;
+        batcher_network(N, [&comparators, &count](size_t i, size_t j) {
+            comparators.low[count] = static_cast<uint8_t>(i);
+            comparators.high[count] = static_cast<uint8_t>(j);
+            count++;
+        });
+        return comparators;
+    }
+
+    static constexpr Comparators comparators = build();
+};
+
+// -:    -    
+template<typename T>
+inline void network_compare_exchange(T& a, T& b) {
+    if constexpr (is_arithmetic_v<T>) {
+        //      :  min/max  NaN  
+        //    .     cmov
+        T x = a, y = b;
+        bool greater = y < x;
+        a = greater ? y : x;
+        b = greater ? x : y;
+    } else {
+        if (b < a) swap(a, b);
+    }
+}
+
+template<size_t N, typename T, size_t... I>
+inline void apply_sorting_network([[maybe_unused]] T arr[], index_sequence<I...>) {
+    (network_compare_exchange(arr[SortingNetwork<N>::comparators.low[I]],
+                              arr[SortingNetwork<N>::comparators.high[I]]), ...);
+}
+
+//   N  ,   
+template<size_t N, typename T>
+void sort_n(T arr[]) {
+    apply_sorting_network<N>(arr, make_index_sequence<SortingNetwork<N>::size()>());
+}
+
+//  sort_n<0..SORTING_NETWORK_MAX>        
+template<typename T, size_t... N>
+constexpr array<void (*)(T[]), sizeof...(N)> make_sorting_network_table(index_sequence<N...>) {
+    return {{&sort_n<N, T>...}};
+}
+
+template<size_t... N>
+constexpr array<int, sizeof...(N)> make_sorting_network_sizes(index_sequence<N...>) {
+    return {{static_cast<int>(SortingNetwork<N>::size())...}};
+}
+
+//      (n <= SORTING_NETWORK_MAX),  
+template<typename T>
+void sorting_network_sort_instrumented(T arr[], int n, OperationCounts& ops) {
+    static constexpr auto networks = make_sorting_network_table<T>(make_index_sequence<SORTING_NETWORK_MAX + 1>());
+    static constexpr auto sizes = make_sorting_network_sizes(make_index_sequence<SORTING_NETWORK_MAX + 1>());
+
+    if (n > SORTING_NETWORK_MAX) {
+        insertion_sort_instrumented(arr, n, ops);
+        return;
+    }
+    if (n < 2) return;
+
+    networks[n](arr);
+    ops.comparisons += sizes[n];
+    ops.memory_access += 2LL * sizes[n];
+    ops.passes++;
+}
+
+//        
+const int SIMD_SORT_MAX = 16;
+
+// ,      
+template<typename T>
+constexpr bool is_simd_sortable_v = SIMD_SORT_AVAILABLE && (is_same_v<T, int> || is_same_v<T, float>);
+
+//   AVX2  (CPUID,    )
+inline bool cpu_supports_avx2() {
+#if SIMD_SORT_AVAILABLE
+    static const bool supported = __builtin_cpu_supports("avx2");
+    return supported;
+#else
+    return false;
+#endif
+}
+
+#if SIMD_SORT_AVAILABLE
+//   AVX2  int  float
+AVX2_TARGET inline __m256i simd_min(__m256i a, __m256i b) { return _mm256_min_epi32(a, b); }
+AVX2_TARGET inline __m256 simd_min(__m256 a, __m256 b) { return _mm256_min_ps(a, b); }
+AVX2_TARGET inline __m256i simd_max(__m256i a, __m256i b) { return _mm256_max_epi32(a, b); }
+AVX2_TARGET inline __m256 simd_max(__m256 a, __m256 b) { return _mm256_max_ps(a, b); }
+AVX2_TARGET inline __m256i simd_load(const int* p) { return _mm256_load_si256(reinterpret_cast<const __m256i*>(p)); }
+AVX2_TARGET inline __m256 simd_load(const float* p) { return _mm256_load_ps(p); }
+AVX2_TARGET inline void simd_store(int* p, __m256i v) { _mm256_store_si256(reinterpret_cast<__m256i*>(p), v); }
+AVX2_TARGET inline void simd_store(float* p, __m256 v) { _mm256_store_ps(p, v); }
+AVX2_TARGET inline __m256i simd_permute(__m256i v, __m256i idx) { return _mm256_permutevar8x32_epi32(v, idx); }
+AVX2_TARGET inline __m256 simd_permute(__m256 v, __m256i idx) { return _mm256_permutevar8x32_ps(v, idx); }
+
+template<int Mask>
+AVX2_TARGET inline __m256i simd_blend(__m256i a, __m256i b) { return _mm256_blend_epi32(a, b, Mask); }
+template<int Mask>
+AVX2_TARGET inline __m256 simd_blend(__m256 a, __m256 b) { return _mm256_blend_ps(a, b, Mask); }
+
+//   :   , Mask - ,  
+template<int Mask, typename V>
+AVX2_TARGET inline V simd_compare_exchange(V v, __m256i perm) {
+    V partner = simd_permute(v, perm);
+    return simd_blend<Mask>(simd_min(v, partner), simd_max(v, partner));
+}
+
+//    8     (19 , 6 )
+template<typename V>
+AVX2_TARGET inline V simd_sort8(V v) {
+    v = simd_compare_exchange<0xCC>(v, _mm256_setr_epi32(2, 3, 0, 1, 6, 7, 4, 5));
+    v = simd_compare_exchange<0xF0>(v, _mm256_setr_epi32(4, 5, 6, 7, 0, 1, 2, 3));
+    v = simd_compare_exchange<0xAA>(v, _mm256_setr_epi32(1, 0, 3, 2, 5, 4, 7, 6));
+    v = simd_compare_exchange<0x30>(v, _mm256_setr_epi32(0, 1, 4, 5, 2, 3, 6, 7));
+    v = simd_compare_exchange<0x50>(v, _mm256_setr_epi32(0, 4, 2, 6, 1, 5, 3, 7));
+    v = simd_compare_exchange<0x54>(v, _mm256_setr_epi32(0, 2, 1, 4, 3, 6, 5, 7));
+    return v;
+}
+
+//  :     8 
+template<typename V>
+AVX2_TARGET inline V simd_bitonic_merge8(V v) {
+    v = simd_compare_exchange<0xF0>(v, _mm256_setr_epi32(4, 5, 6, 7, 0, 1, 2, 3));
+    v = simd_compare_exchange<0xCC>(v, _mm256_setr_epi32(2, 3, 0, 1, 6, 7, 4, 5));
+    v = simd_compare_exchange<0xAA>(v, _mm256_setr_epi32(1, 0, 3, 2, 5, 4, 7, 6));
+    return v;
+}
+
+//   16    AVX2. false -    NaN,  
+// : min/max AVX  NaN   ,     
+template<typename T>
+AVX2_TARGET bool simd_sort16(T arr[], int n) {
+    //      
+    alignas(32) T buffer[SIMD_SORT_MAX];
+    const T padding = is_same_v<T, int> ? numeric_limits<T>::max() : numeric_limits<T>::infinity();
+    for (int i = 0; i < SIMD_SORT_MAX; i++) {
+        buffer[i] = i < n ? arr[i] : padding;
+    }
+
+    auto low = simd_load(buffer);
+    auto high = simd_load(buffer + 8);
+    if constexpr (is_same_v<T, float>) {
+        __m256 unordered = _mm256_or_ps(_mm256_cmp_ps(low, low, _CMP_UNORD_Q), _mm256_cmp_ps(high, high, _CMP_UNORD_Q));
+        if (_mm256_movemask_ps(unordered) != 0) return false;
+    }
+
+    low = simd_sort8(low);
+    if (n > 8) {
+        //        16 
+        high = simd_permute(simd_sort8(high), _mm256_setr_epi32(7, 6, 5, 4, 3, 2, 1, 0));
+        auto merged_low = simd_min(low, high);
+        auto merged_high = simd_max(low, high);
+        low = simd_bitonic_merge8(merged_low);
+        high = simd_bitonic_merge8(merged_high);
+    }
+
+    simd_store(buffer, low);
+    simd_store(buffer + 8, high);
+
+    for (int i = 0; i < n; i++) {
+        arr[i] = buffer[i];
+    }
+    return true;
+}
+#endif
+
+//   :  AVX2,   (    NaN), 
+//     ,  
+template<typename T>
+void small_sort_instrumented(T arr[], int n, OperationCounts& ops) {
+#if SIMD_SORT_AVAILABLE
+    if constexpr (is_simd_sortable_v<T>) {
+        if (n <= SIMD_SORT_MAX && cpu_supports_avx2() && simd_sort16(arr, n)) {
+            // 19   , 8 + 2 * 12 -    
+            ops.comparisons += n > 8 ? 2 * 19 + 8 + 2 * 12 : 19;
+            ops.memory_access += 2LL * n;
+            return;
+        }
+    }
+#endif
+    if constexpr (is_arithmetic_v<T>) {
+        if (n <= SORTING_NETWORK_MAX) {
+            sorting_network_sort_instrumented(arr, n, ops);
+            return;
+        }
+    }
+    insertion_sort_instrumented(arr, n, ops);
+}
+
 //   ( )
 template<typename T>
 void quick_sort_instrumented(T arr[], int low, int high, OperationCounts& ops) {
@@ -698,6 +1347,33 @@ void merge_instrumented(T arr[], int left, int mid, int right, OperationCounts&
     ops.remove_memory(temp_memory);
 }
 
+//    A  B    (  )
+template<typename T>
+void merge_range_instrumented(T a[], int n1, T b[], int n2, T out[], OperationCounts& ops) {
+    int i = 0, j = 0, k = 0;
+
+    while (i < n1 && j < n2) {
+        ops.comparisons++;
+        ops.memory_access += 2;
+        if (!(b[j] < a[i])) {
+            out[k++] = move(a[i++]);
+        } else {
+            out[k++] = move(b[j++]);
+        }
+        ops.memory_access += 2;
+    }
+
+    while (i < n1) {
+        out[k++] = move(a[i++]);
+        ops.memory_access += 2;
+    }
+
+    while (j < n2) {
+        out[k++] = move(b[j++]);
+        ops.memory_access += 2;
+    }
+}
+
 //   ( )
 template<typename T>
 void merge_sort_instrumented(T arr[], int left, int right, OperationCounts& ops) {
@@ -721,6 +1397,56 @@ void merge_sort_instrumented(T arr[], int n, OperationCounts& ops) {
     merge_sort_instrumented(arr, 0, n - 1, ops);
 }
 
+//         ;
+// simd_leaves -    SIMD_SORT_MAX    
+template<typename T>
+void bottom_up_merge_sort_instrumented(T arr[], int n, OperationCounts& ops, bool simd_leaves = false) {
+    if (n < 2) return;
+
+    int initial_width = 1;
+    if (simd_leaves) {
+        initial_width = SIMD_SORT_MAX;
+        for (int left = 0; left < n; left += SIMD_SORT_MAX) {
+            small_sort_instrumented(arr + left, min(SIMD_SORT_MAX, n - left), ops);
+        }
+        if (initial_width >= n) return;
+    }
+
+    size_t buffer_memory = sizeof(T) * n;
+    ops.add_memory(buffer_memory);
+    T* buffer = new T[n];
+
+    //   :  ->  -> 
+    T* src = arr;
+    T* dst = buffer;
+
+    for (int width = initial_width; width < n; width *= 2) {
+        for (int left = 0; left < n; left += 2 * width) {
+            int mid = min(left + width, n);
+            int right = min(left + 2 * width, n);
+
+            if (ops.accessed_indices.size() < 10000) {
+                ops.accessed_indices.push_back(left);
+                ops.accessed_indices.push_back(mid);
+            }
+
+            merge_range_instrumented(src + left, mid - left, src + mid, right - mid, dst + left, ops);
+        }
+        swap(src, dst);
+    }
+
+    //        
+    if (src != arr) {
+        for (int i = 0; i < n; i++) {
+            arr[i] = move(src[i]);
+        }
+        ops.memory_access += 2LL * n;
+    }
+
+    delete[] buffer;
+    ops.remove_memory(buffer_memory);
+}
+
 //    
 template<typename T>
 void heapify_instrumented(T arr[], int n, int i, OperationCounts& ops) {
@@ -784,44 +1510,3169 @@ void heap_sort_instrumented(T arr[], int n, OperationCounts& ops) {
     ops.remove_memory(sizeof(int));
 }
 
-//   ( )
+//  :       
+// (   ),      
 template<typename T>
-void std_sort_instrumented(T arr[], int n, OperationCounts& ops) {
-    size_t estimated_memory = sizeof(T) * n * 0.1;
-    if (estimated_memory < 1000) estimated_memory = 1000;
+void bottom_up_sift_down_instrumented(T arr[], int n, int hole, T value, OperationCounts& ops) {
+    int top = hole;
+    int child = 2 * hole + 1;
 
-    ops.add_memory(estimated_memory);
+    while (child < n) {
+        if (child + 1 < n) {
+            ops.comparisons++;
+            ops.memory_access += 2;
+            if (arr[child] < arr[child + 1]) child++;
+        }
+        if (ops.accessed_indices.size() < 10000) {
+            ops.accessed_indices.push_back(child);
+        }
 
-    vector<T> temp(arr, arr + n);
-    ops.memory_access += n * 2;
+        arr[hole] = move(arr[child]);
+        ops.memory_access += 2;
+        hole = child;
+        child = 2 * hole + 1;
+    }
 
-    auto start = chrono::high_resolution_clock::now();
-    std::sort(temp.begin(), temp.end());
-    auto end = chrono::high_resolution_clock::now();
+    while (hole > top) {
+        int parent = (hole - 1) / 2;
+        ops.comparisons++;
+        ops.memory_access++;
+        if (!(arr[parent] < value)) break;
 
-    for (int i = 0; i < n; i++) {
-        arr[i] = temp[i];
+        arr[hole] = move(arr[parent]);
+        ops.memory_access += 2;
+        hole = parent;
     }
 
-    //    std::sort
-    ops.comparisons = n * log2(n) * 1.5;
-    ops.swaps = n * log2(n) * 0.5;
-
-    ops.remove_memory(estimated_memory);
+    arr[hole] = move(value);
+    ops.memory_access++;
 }
 
-//      
+//    (,   )
 template<typename T>
-T* create_array(int n, int type) {
-    T* arr = new T[n];
+void bottom_up_heap_sort_instrumented(T arr[], int n, OperationCounts& ops) {
+    ops.add_memory(sizeof(T) + sizeof(int) * 3);
 
-    if constexpr (is_integral_v<T> && !is_same_v<T, bool>) {
-        switch (type) {
-            case 0: // 
-                for (int i = 0; i < n; i++) {
-                    arr[i] = rand_uns(1, 10000);
-                }
-                break;
+    //  
+    for (int i = n / 2 - 1; i >= 0; i--) {
+        T value = move(arr[i]);
+        bottom_up_sift_down_instrumented(arr, n, i, move(value), ops);
+    }
+
+    // :    ,     
+    for (int end = n - 1; end > 0; end--) {
+        T value = move(arr[end]);
+        arr[end] = move(arr[0]);
+        ops.swaps++;
+        ops.memory_access += 4;
+        bottom_up_sift_down_instrumented(arr, end, 0, move(value), ops);
+    }
+
+    ops.remove_memory(sizeof(T) + sizeof(int) * 3);
+}
+
+//     d- 
+const int HEAP_ARITY = 4;
+
+//   4- :     (-  )
+template<typename T>
+void quaternary_sift_down_instrumented(T arr[], int n, int hole, T value, OperationCounts& ops) {
+    while (true) {
+        int first = HEAP_ARITY * hole + 1;
+        if (first >= n) break;
+        int last = min(first + HEAP_ARITY, n);
+        if (ops.accessed_indices.size() < 10000) {
+            ops.accessed_indices.push_back(first);
+        }
+
+        //   
+        int largest = first;
+        for (int child = first + 1; child < last; child++) {
+            ops.comparisons++;
+            if (arr[largest] < arr[child]) largest = child;
+        }
+        ops.memory_access += last - first;
+
+        ops.comparisons++;
+        if (!(value < arr[largest])) break;
+
+        arr[hole] = move(arr[largest]);
+        ops.memory_access += 2;
+        hole = largest;
+    }
+
+    arr[hole] = move(value);
+    ops.memory_access++;
+}
+
+//    4-  (   )
+template<typename T>
+void quaternary_heap_sort_instrumented(T arr[], int n, OperationCounts& ops) {
+    if (n < 2) return;
+    ops.add_memory(sizeof(T) + sizeof(int) * 4);
+
+    //      
+    for (int i = (n - 2) / HEAP_ARITY; i >= 0; i--) {
+        T value = move(arr[i]);
+        quaternary_sift_down_instrumented(arr, n, i, move(value), ops);
+    }
+
+    for (int end = n - 1; end > 0; end--) {
+        T value = move(arr[end]);
+        arr[end] = move(arr[0]);
+        ops.swaps++;
+        ops.memory_access += 4;
+        quaternary_sift_down_instrumented(arr, end, 0, move(value), ops);
+    }
+
+    ops.remove_memory(sizeof(T) + sizeof(int) * 4);
+}
+
+//      Timsort (  )
+const int TIMSORT_MIN_MERGE = 32;
+
+//      
+const int TIMSORT_MIN_GALLOP = 7;
+
+//  Timsort:  ,      
+template<typename T>
+class TimsortState {
+private:
+    T* arr;
+    T* tmp;
+    int min_gallop = TIMSORT_MIN_GALLOP;
+    vector<int> run_base;
+    vector<int> run_len;
+    OperationCounts& ops;
+
+    bool less(const T& a, const T& b) {
+        ops.comparisons++;
+        ops.memory_access += 2;
+        return a < b;
+    }
+
+    //  count   (dst <= src   )
+    void move_forward(T* src, T* dst, int count) {
+        for (int i = 0; i < count; i++) {
+            dst[i] = move(src[i]);
+        }
+        ops.memory_access += 2LL * count;
+    }
+
+    //  count    (dst >= src  )
+    void move_backward(T* src, T* dst, int count) {
+        for (int i = count - 1; i >= 0; i--) {
+            dst[i] = move(src[i]);
+        }
+        ops.memory_access += 2LL * count;
+    }
+
+    //      key   a[base..base+len),   hint
+    int gallop_left(const T& key, T* a, int base, int len, int hint) {
+        int last_ofs = 0;
+        int ofs = 1;
+        if (less(a[base + hint], key)) {
+            int max_ofs = len - hint;
+            while (ofs < max_ofs && less(a[base + hint + ofs], key)) {
+                last_ofs = ofs;
+                ofs = (ofs << 1) + 1;
+                if (ofs <= 0) ofs = max_ofs;
+            }
+            if (ofs > max_ofs) ofs = max_ofs;
+            last_ofs += hint;
+            ofs += hint;
+        } else {
+            int max_ofs = hint + 1;
+            while (ofs < max_ofs && !less(a[base + hint - ofs], key)) {
+                last_ofs = ofs;
+                ofs = (ofs << 1) + 1;
+                if (ofs <= 0) ofs = max_ofs;
+            }
+            if (ofs > max_ofs) ofs = max_ofs;
+            int temp = last_ofs;
+            last_ofs = hint - ofs;
+            ofs = hint - temp;
+        }
+
+        last_ofs++;
+        while (last_ofs < ofs) {
+            int mid = last_ofs + (ofs - last_ofs) / 2;
+            if (less(a[base + mid], key)) last_ofs = mid + 1;
+            else ofs = mid;
+        }
+        return ofs;
+    }
+
+    //      key (  ),   hint
+    int gallop_right(const T& key, T* a, int base, int len, int hint) {
+        int last_ofs = 0;
+        int ofs = 1;
+        if (less(key, a[base + hint])) {
+            int max_ofs = hint + 1;
+            while (ofs < max_ofs && less(key, a[base + hint - ofs])) {
+                last_ofs = ofs;
+                ofs = (ofs << 1) + 1;
+                if (ofs <= 0) ofs = max_ofs;
+            }
+            if (ofs > max_ofs) ofs = max_ofs;
+            int temp = last_ofs;
+            last_ofs = hint - ofs;
+            ofs = hint - temp;
+        } else {
+            int max_ofs = len - hint;
+            while (ofs < max_ofs && !less(key, a[base + hint + ofs])) {
+                last_ofs = ofs;
+                ofs = (ofs << 1) + 1;
+                if (ofs <= 0) ofs = max_ofs;
+            }
+            if (ofs > max_ofs) ofs = max_ofs;
+            last_ofs += hint;
+            ofs += hint;
+        }
+
+        last_ofs++;
+        while (last_ofs < ofs) {
+            int mid = last_ofs + (ofs - last_ofs) / 2;
+            if (less(key, a[base + mid])) ofs = mid;
+            else last_ofs = mid + 1;
+        }
+        return ofs;
+    }
+
+    //    (  ),     
+    void merge_low(int base1, int len1, int base2, int len2) {
+        move_forward(arr + base1, tmp, len1);
+        int cursor1 = 0;
+        int cursor2 = base2;
+        int dest = base1;
+
+        arr[dest++] = move(arr[cursor2++]);
+        ops.memory_access += 2;
+        if (--len2 == 0) {
+            move_forward(tmp + cursor1, arr + dest, len1);
+            return;
+        }
+        if (len1 == 1) {
+            move_forward(arr + cursor2, arr + dest, len2);
+            arr[dest + len2] = move(tmp[cursor1]);
+            return;
+        }
+
+        int gallop = min_gallop;
+        bool done = false;
+        while (!done) {
+            int count1 = 0;
+            int count2 = 0;
+
+            //  ,        gallop 
+            do {
+                if (less(arr[cursor2], tmp[cursor1])) {
+                    arr[dest++] = move(arr[cursor2++]);
+                    count2++;
+                    count1 = 0;
+                    if (--len2 == 0) { done = true; break; }
+                } else {
+                    arr[dest++] = move(tmp[cursor1++]);
+                    count1++;
+                    count2 = 0;
+                    if (--len1 == 1) { done = true; break; }
+                }
+                ops.memory_access += 2;
+            } while ((count1 | count2) < gallop);
+            if (done) break;
+
+            //  :   ,   
+            do {
+                count1 = gallop_right(arr[cursor2], tmp, cursor1, len1, 0);
+                if (count1 != 0) {
+                    move_forward(tmp + cursor1, arr + dest, count1);
+                    dest += count1;
+                    cursor1 += count1;
+                    len1 -= count1;
+                    if (len1 <= 1) { done = true; break; }
+                }
+                arr[dest++] = move(arr[cursor2++]);
+                if (--len2 == 0) { done = true; break; }
+
+                count2 = gallop_left(tmp[cursor1], arr, cursor2, len2, 0);
+                if (count2 != 0) {
+                    move_forward(arr + cursor2, arr + dest, count2);
+                    dest += count2;
+                    cursor2 += count2;
+                    len2 -= count2;
+                    if (len2 == 0) { done = true; break; }
+                }
+                arr[dest++] = move(tmp[cursor1++]);
+                if (--len1 == 1) { done = true; break; }
+                gallop--;
+            } while (count1 >= TIMSORT_MIN_GALLOP || count2 >= TIMSORT_MIN_GALLOP);
+            if (done) break;
+
+            if (gallop < 0) gallop = 0;
+            gallop += 2;
+        }
+        min_gallop = max(1, gallop);
+
+        if (len1 == 1) {
+            move_forward(arr + cursor2, arr + dest, len2);
+            arr[dest + len2] = move(tmp[cursor1]);
+        } else {
+            move_forward(tmp + cursor1, arr + dest, len1);
+        }
+    }
+
+    //    (  ),     
+    void merge_high(int base1, int len1, int base2, int len2) {
+        move_forward(arr + base2, tmp, len2);
+        int cursor1 = base1 + len1 - 1;
+        int cursor2 = len2 - 1;
+        int dest = base2 + len2 - 1;
+
+        arr[dest--] = move(arr[cursor1--]);
+        ops.memory_access += 2;
+        if (--len1 == 0) {
+            move_forward(tmp, arr + dest - (len2 - 1), len2);
+            return;
+        }
+        if (len2 == 1) {
+            dest -= len1;
+            cursor1 -= len1;
+            move_backward(arr + cursor1 + 1, arr + dest + 1, len1);
+            arr[dest] = move(tmp[cursor2]);
+            return;
+        }
+
+        int gallop = min_gallop;
+        bool done = false;
+        while (!done) {
+            int count1 = 0;
+            int count2 = 0;
+
+            do {
+                if (less(tmp[cursor2], arr[cursor1])) {
+                    arr[dest--] = move(arr[cursor1--]);
+                    count1++;
+                    count2 = 0;
+                    if (--len1 == 0) { done = true; break; }
+                } else {
+                    arr[dest--] = move(tmp[cursor2--]);
+                    count2++;
+                    count1 = 0;
+                    if (--len2 == 1) { done = true; break; }
+                }
+                ops.memory_access += 2;
+            } while ((count1 | count2) < gallop);
+            if (done) break;
+
+            do {
+                count1 = len1 - gallop_right(tmp[cursor2], arr, base1, len1, len1 - 1);
+                if (count1 != 0) {
+                    dest -= count1;
+                    cursor1 -= count1;
+                    len1 -= count1;
+                    move_backward(arr + cursor1 + 1, arr + dest + 1, count1);
+                    if (len1 == 0) { done = true; break; }
+                }
+                arr[dest--] = move(tmp[cursor2--]);
+                if (--len2 == 1) { done = true; break; }
+
+                count2 = len2 - gallop_left(arr[cursor1], tmp, 0, len2, len2 - 1);
+                if (count2 != 0) {
+                    dest -= count2;
+                    cursor2 -= count2;
+                    len2 -= count2;
+                    move_forward(tmp + cursor2 + 1, arr + dest + 1, count2);
+                    if (len2 <= 1) { done = true; break; }
+                }
+                arr[dest--] = move(arr[cursor1--]);
+                if (--len1 == 0) { done = true; break; }
+                gallop--;
+            } while (count1 >= TIMSORT_MIN_GALLOP || count2 >= TIMSORT_MIN_GALLOP);
+            if (done) break;
+
+            if (gallop < 0) gallop = 0;
+            gallop += 2;
+        }
+        min_gallop = max(1, gallop);
+
+        if (len2 == 1) {
+            dest -= len1;
+            cursor1 -= len1;
+            move_backward(arr + cursor1 + 1, arr + dest + 1, len1);
+            arr[dest] = move(tmp[cursor2]);
+        } else {
+            move_forward(tmp, arr + dest - (len2 - 1), len2);
+        }
+    }
+
+    //   i  i + 1  
+    void merge_at(int i) {
+        int base1 = run_base[i];
+        int len1 = run_len[i];
+        int base2 = run_base[i + 1];
+        int len2 = run_len[i + 1];
+
+        run_len[i] = len1 + len2;
+        run_base.erase(run_base.begin() + i + 1);
+        run_len.erase(run_len.begin() + i + 1);
+
+        if (ops.accessed_indices.size() < 10000) {
+            ops.accessed_indices.push_back(base1);
+            ops.accessed_indices.push_back(base2);
+        }
+
+        //   ,   ,   
+        int k = gallop_right(arr[base2], arr, base1, len1, 0);
+        base1 += k;
+        len1 -= k;
+        if (len1 == 0) return;
+
+        //   ,   ,   
+        len2 = gallop_left(arr[base1 + len1 - 1], arr, base2, len2, len2 - 1);
+        if (len2 == 0) return;
+
+        if (len1 <= len2) merge_low(base1, len1, base2, len2);
+        else merge_high(base1, len1, base2, len2);
+    }
+
+public:
+    TimsortState(T* array, T* buffer, OperationCounts& counts) : arr(array), tmp(buffer), ops(counts) {}
+
+    void push_run(int base, int len) {
+        run_base.push_back(base);
+        run_len.push_back(len);
+    }
+
+    //    
+    void merge_collapse() {
+        while (run_len.size() > 1) {
+            int n = static_cast<int>(run_len.size()) - 2;
+            if ((n > 0 && run_len[n - 1] <= run_len[n] + run_len[n + 1]) ||
+                (n > 1 && run_len[n - 2] <= run_len[n] + run_len[n - 1])) {
+                if (run_len[n - 1] < run_len[n + 1]) n--;
+            } else if (run_len[n] > run_len[n + 1]) {
+                break;
+            }
+            merge_at(n);
+        }
+    }
+
+    //    
+    void merge_force_collapse() {
+        while (run_len.size() > 1) {
+            int n = static_cast<int>(run_len.size()) - 2;
+            if (n > 0 && run_len[n - 1] < run_len[n + 1]) n--;
+            merge_at(n);
+        }
+    }
+};
+
+//  ,   low;    
+template<typename T>
+int count_run_and_make_ascending(T arr[], int low, int high, OperationCounts& ops) {
+    int run_high = low + 1;
+    if (run_high == high) return 1;
+
+    ops.comparisons++;
+    ops.memory_access += 2;
+    if (arr[run_high++] < arr[low]) {
+        while (run_high < high && arr[run_high] < arr[run_high - 1]) {
+            ops.comparisons++;
+            ops.memory_access += 2;
+            run_high++;
+        }
+        reverse(arr + low, arr + run_high);
+        ops.swaps += (run_high - low) / 2;
+        ops.memory_access += 2LL * (run_high - low);
+    } else {
+        while (run_high < high && !(arr[run_high] < arr[run_high - 1])) {
+            ops.comparisons++;
+            ops.memory_access += 2;
+            run_high++;
+        }
+    }
+
+    return run_high - low;
+}
+
+//     Timsort
+inline int timsort_min_run(int n) {
+    int r = 0;
+    while (n >= TIMSORT_MIN_MERGE) {
+        r |= (n & 1);
+        n >>= 1;
+    }
+    return n + r;
+}
+
+// Timsort:      
+template<typename T>
+void timsort_instrumented(T arr[], int n, OperationCounts& ops) {
+    if (n < 2) return;
+
+    if (n < TIMSORT_MIN_MERGE) {
+        int run = count_run_and_make_ascending(arr, 0, n, ops);
+        binary_insertion_sort_instrumented(arr, 0, n, run, ops);
+        return;
+    }
+
+    size_t buffer_memory = sizeof(T) * (n / 2 + 1);
+    ops.add_memory(buffer_memory);
+    T* buffer = new T[n / 2 + 1];
+
+    TimsortState<T> state(arr, buffer, ops);
+    int min_run = timsort_min_run(n);
+    int low = 0;
+    int remaining = n;
+
+    do {
+        int run = count_run_and_make_ascending(arr, low, n, ops);
+
+        //       min_run
+        if (run < min_run) {
+            int force = min(remaining, min_run);
+            binary_insertion_sort_instrumented(arr, low, low + force, low + run, ops);
+            run = force;
+        }
+
+        state.push_run(low, run);
+        state.merge_collapse();
+
+        low += run;
+        remaining -= run;
+    } while (remaining != 0);
+
+    state.merge_force_collapse();
+
+    delete[] buffer;
+    ops.remove_memory(buffer_memory);
+}
+
+//        
+const int INTROSORT_THRESHOLD = 16;
+
+//          ninther
+const int NINTHER_THRESHOLD = 128;
+
+//   : arr[a] <= arr[b] <= arr[c]
+template<typename T>
+void sort_three_instrumented(T arr[], int a, int b, int c, OperationCounts& ops) {
+    ops.comparisons++;
+    ops.memory_access += 2;
+    if (arr[b] < arr[a]) {
+        ops.swaps++;
+        ops.memory_access += 4;
+        swap(arr[a], arr[b]);
+    }
+
+    ops.comparisons++;
+    ops.memory_access += 2;
+    if (arr[c] < arr[b]) {
+        ops.swaps++;
+        ops.memory_access += 4;
+        swap(arr[b], arr[c]);
+
+        ops.comparisons++;
+        ops.memory_access += 2;
+        if (arr[b] < arr[a]) {
+            ops.swaps++;
+            ops.memory_access += 4;
+            swap(arr[a], arr[b]);
+        }
+    }
+}
+
+//    (   ninther),    
+template<typename T>
+int choose_pivot_instrumented(T arr[], int low, int high, OperationCounts& ops) {
+    int mid = low + (high - low) / 2;
+    int size = high - low + 1;
+
+    if (size > NINTHER_THRESHOLD) {
+        int step = size / 8;
+        sort_three_instrumented(arr, low, low + step, low + 2 * step, ops);
+        sort_three_instrumented(arr, mid - step, mid, mid + step, ops);
+        sort_three_instrumented(arr, high - 2 * step, high - step, high, ops);
+        sort_three_instrumented(arr, low + step, mid, high - step, ops);
+    } else {
+        sort_three_instrumented(arr, low, mid, high, ops);
+    }
+
+    return mid;
+}
+
+//      
+template<typename T>
+int hoare_partition_instrumented(T arr[], int low, int high, const T& pivot, OperationCounts& ops) {
+    int i = low - 1;
+    int j = high + 1;
+
+    while (true) {
+        do {
+            i++;
+            ops.comparisons++;
+            ops.memory_access++;
+            if (ops.accessed_indices.size() < 10000) {
+                ops.accessed_indices.push_back(i);
+            }
+        } while (arr[i] < pivot);
+
+        do {
+            j--;
+            ops.comparisons++;
+            ops.memory_access++;
+            if (ops.accessed_indices.size() < 10000) {
+                ops.accessed_indices.push_back(j);
+            }
+        } while (arr[j] > pivot);
+
+        if (i >= j) return j;
+
+        ops.swaps++;
+        ops.memory_access += 4;
+        swap(arr[i], arr[j]);
+    }
+}
+
+//   ( )
+template<typename T>
+void introsort_instrumented(T arr[], int low, int high, int depth_limit, OperationCounts& ops,
+                            bool simd_leaves = false) {
+    ops.add_memory(sizeof(int) * 4);
+
+    while (high - low + 1 > INTROSORT_THRESHOLD) {
+        //    -    
+        if (depth_limit == 0) {
+            heap_sort_instrumented(arr + low, high - low + 1, ops);
+            ops.remove_memory(sizeof(int) * 4);
+            return;
+        }
+        depth_limit--;
+
+        int pivot_idx = choose_pivot_instrumented(arr, low, high, ops);
+        T pivot = arr[pivot_idx];
+        ops.memory_access++;
+
+        int j = hoare_partition_instrumented(arr, low, high, pivot, ops);
+
+        //    ,    -  O(log n)
+        if (j - low < high - j) {
+            introsort_instrumented(arr, low, j, depth_limit, ops, simd_leaves);
+            low = j + 1;
+        } else {
+            introsort_instrumented(arr, j + 1, high, depth_limit, ops, simd_leaves);
+            high = j;
+        }
+    }
+
+    if (high > low) {
+        if (simd_leaves) {
+            small_sort_instrumented(arr + low, high - low + 1, ops);
+        } else {
+            insertion_sort_instrumented(arr + low, high - low + 1, ops);
+        }
+    }
+
+    ops.remove_memory(sizeof(int) * 4);
+}
+
+//   (); simd_leaves -     
+template<typename T>
+void introsort_instrumented(T arr[], int n, OperationCounts& ops, bool simd_leaves = false) {
+    if (n < 2) return;
+    int depth_limit = 2 * static_cast<int>(log2(n));
+    introsort_instrumented(arr, 0, n - 1, depth_limit, ops, simd_leaves);
+}
+
+//     :     
+enum class SimdLevel { Scalar, Avx2, Avx512 };
+
+//      (CPUID,    )
+inline SimdLevel cpu_simd_level() {
+#if SIMD_SORT_AVAILABLE
+    static const SimdLevel level = __builtin_cpu_supports("avx512f") ? SimdLevel::Avx512
+                                 : __builtin_cpu_supports("avx2") ? SimdLevel::Avx2
+                                 : SimdLevel::Scalar;
+    return level;
+#else
+    return SimdLevel::Scalar;
+#endif
+}
+
+// ,     
+template<typename T>
+constexpr bool is_vector_partitionable_v = is_same_v<T, int> || is_same_v<T, float> || is_same_v<T, double>;
+
+//      ( SIMD)
+template<typename T>
+struct ScalarPartition {
+    static constexpr int WIDTH = 1;
+
+    static int split(const T* src, T pivot, bool inclusive, T* left, T* right_end) {
+        T value = *src;
+        if (inclusive ? !(pivot < value) : value < pivot) {
+            *left = value;
+            return 1;
+        }
+        right_end[-1] = value;
+        return 0;
+    }
+};
+
+#if SIMD_SORT_AVAILABLE
+#define AVX512_TARGET __attribute__((target("avx512f")))
+
+//    :      ,  
+template<int Lanes>
+struct SimdCompressTable {
+    alignas(32) int indices[1 << Lanes][8];
+
+    SimdCompressTable() {
+        //  4   64    -  32- 
+        const int scale = 8 / Lanes;
+        for (int mask = 0; mask < (1 << Lanes); mask++) {
+            int pos = 0;
+            for (int pass = 0; pass < 2; pass++) {
+                for (int lane = 0; lane < Lanes; lane++) {
+                    if (((mask >> lane) & 1) != (pass == 0 ? 1 : 0)) continue;
+                    for (int k = 0; k < scale; k++) {
+                        indices[mask][pos++] = lane * scale + k;
+                    }
+                }
+            }
+        }
+    }
+};
+
+const SimdCompressTable<8> simd_compress_table_32;
+const SimdCompressTable<4> simd_compress_table_64;
+
+//   AVX2:      ,  -  
+template<typename T>
+struct Avx2Partition;
+
+template<>
+struct Avx2Partition<int> {
+    static constexpr int WIDTH = 8;
+
+    AVX2_TARGET static int split(const int* src, int pivot, bool inclusive, int* left, int* right_end) {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src));
+        __m256i p = _mm256_set1_epi32(pivot);
+        int mask = inclusive ? ~_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(v, p))) & 0xFF
+                             : _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(p, v)));
+        __m256i perm = _mm256_load_si256(reinterpret_cast<const __m256i*>(simd_compress_table_32.indices[mask]));
+        __m256i packed = _mm256_permutevar8x32_epi32(v, perm);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(left), packed);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(right_end - WIDTH), packed);
+        return __builtin_popcount(mask);
+    }
+};
+
+template<>
+struct Avx2Partition<float> {
+    static constexpr int WIDTH = 8;
+
+    AVX2_TARGET static int split(const float* src, float pivot, bool inclusive, float* left, float* right_end) {
+        __m256 v = _mm256_loadu_ps(src);
+        __m256 p = _mm256_set1_ps(pivot);
+        int mask = _mm256_movemask_ps(inclusive ? _mm256_cmp_ps(v, p, _CMP_NGT_UQ) : _mm256_cmp_ps(v, p, _CMP_LT_OQ));
+        __m256i perm = _mm256_load_si256(reinterpret_cast<const __m256i*>(simd_compress_table_32.indices[mask]));
+        __m256 packed = _mm256_permutevar8x32_ps(v, perm);
+        _mm256_storeu_ps(left, packed);
+        _mm256_storeu_ps(right_end - WIDTH, packed);
+        return __builtin_popcount(mask);
+    }
+};
+
+template<>
+struct Avx2Partition<double> {
+    static constexpr int WIDTH = 4;
+
+    AVX2_TARGET static int split(const double* src, double pivot, bool inclusive, double* left, double* right_end) {
+        __m256d v = _mm256_loadu_pd(src);
+        __m256d p = _mm256_set1_pd(pivot);
+        int mask = _mm256_movemask_pd(inclusive ? _mm256_cmp_pd(v, p, _CMP_NGT_UQ) : _mm256_cmp_pd(v, p, _CMP_LT_OQ));
+        __m256i perm = _mm256_load_si256(reinterpret_cast<const __m256i*>(simd_compress_table_64.indices[mask]));
+        __m256d packed = _mm256_castps_pd(_mm256_permutevar8x32_ps(_mm256_castpd_ps(v), perm));
+        _mm256_storeu_pd(left, packed);
+        _mm256_storeu_pd(right_end - WIDTH, packed);
+        return __builtin_popcount(mask);
+    }
+};
+
+//   AVX-512     
+template<typename T>
+struct Avx512Partition;
+
+template<>
+struct Avx512Partition<int> {
+    static constexpr int WIDTH = 16;
+
+    AVX512_TARGET static int split(const int* src, int pivot, bool inclusive, int* left, int* right_end) {
+        __m512i v = _mm512_loadu_si512(src);
+        __m512i p = _mm512_set1_epi32(pivot);
+        __mmask16 mask = inclusive ? _mm512_cmple_epi32_mask(v, p) : _mm512_cmplt_epi32_mask(v, p);
+        int count = __builtin_popcount(mask);
+        _mm512_storeu_si512(left, _mm512_maskz_compress_epi32(mask, v));
+        _mm512_mask_storeu_epi32(right_end - (WIDTH - count), static_cast<__mmask16>((1u << (WIDTH - count)) - 1),
+                                 _mm512_maskz_compress_epi32(static_cast<__mmask16>(~mask), v));
+        return count;
+    }
+};
+
+template<>
+struct Avx512Partition<float> {
+    static constexpr int WIDTH = 16;
+
+    AVX512_TARGET static int split(const float* src, float pivot, bool inclusive, float* left, float* right_end) {
+        __m512 v = _mm512_loadu_ps(src);
+        __m512 p = _mm512_set1_ps(pivot);
+        __mmask16 mask = inclusive ? _mm512_cmp_ps_mask(v, p, _CMP_NGT_UQ) : _mm512_cmp_ps_mask(v, p, _CMP_LT_OQ);
+        int count = __builtin_popcount(mask);
+        _mm512_storeu_ps(left, _mm512_maskz_compress_ps(mask, v));
+        _mm512_mask_storeu_ps(right_end - (WIDTH - count), static_cast<__mmask16>((1u << (WIDTH - count)) - 1),
+                              _mm512_maskz_compress_ps(static_cast<__mmask16>(~mask), v));
+        return count;
+    }
+};
+
+template<>
+struct Avx512Partition<double> {
+    static constexpr int WIDTH = 8;
+
+    AVX512_TARGET static int split(const double* src, double pivot, bool inclusive, double* left, double* right_end) {
+        __m512d v = _mm512_loadu_pd(src);
+        __m512d p = _mm512_set1_pd(pivot);
+        __mmask8 mask = inclusive ? _mm512_cmp_pd_mask(v, p, _CMP_NGT_UQ) : _mm512_cmp_pd_mask(v, p, _CMP_LT_OQ);
+        int count = __builtin_popcount(mask);
+        _mm512_storeu_pd(left, _mm512_maskz_compress_pd(mask, v));
+        _mm512_mask_storeu_pd(right_end - (WIDTH - count), static_cast<__mmask8>((1u << (WIDTH - count)) - 1),
+                              _mm512_maskz_compress_pd(static_cast<__mmask8>(~mask), v));
+        return count;
+    }
+};
+#endif
+
+//  [low, high)   pivot:   < pivot (<=  inclusive),
+//  .    ,       
+template<typename Policy, typename T>
+int vector_partition_loop(T arr[], int low, int high, T pivot, bool inclusive) {
+    constexpr int W = Policy::WIDTH;
+    T pending[3 * W];
+    int pending_count = 0;
+    int left = low;
+    int right = high;
+
+    if (high - low >= 2 * W) {
+        for (int i = 0; i < W; i++) {
+            pending[pending_count++] = arr[low + i];
+            pending[pending_count++] = arr[high - W + i];
+        }
+
+        int read_left = low + W;
+        int read_right = high - W;
+        while (read_right - read_left >= W) {
+            //    ,    
+            const T* src;
+            if (read_left - left <= right - read_right) {
+                src = arr + read_left;
+                read_left += W;
+            } else {
+                read_right -= W;
+                src = arr + read_right;
+            }
+
+            int count = Policy::split(src, pivot, inclusive, arr + left, arr + right);
+            left += count;
+            right -= W - count;
+        }
+
+        for (int i = read_left; i < read_right; i++) {
+            pending[pending_count++] = arr[i];
+        }
+    } else {
+        for (int i = low; i < high; i++) {
+            pending[pending_count++] = arr[i];
+        }
+    }
+
+    for (int i = 0; i < pending_count; i++) {
+        const T& value = pending[i];
+        if (inclusive ? !(pivot < value) : value < pivot) {
+            arr[left++] = value;
+        } else {
+            arr[--right] = value;
+        }
+    }
+
+    return left;
+}
+
+#if SIMD_SORT_AVAILABLE
+//      : flatten    
+template<typename T>
+AVX2_TARGET __attribute__((flatten)) int vector_partition_avx2(T arr[], int low, int high, T pivot, bool inclusive) {
+    return vector_partition_loop<Avx2Partition<T>>(arr, low, high, pivot, inclusive);
+}
+
+template<typename T>
+AVX512_TARGET __attribute__((flatten)) int vector_partition_avx512(T arr[], int low, int high, T pivot, bool inclusive) {
+    return vector_partition_loop<Avx512Partition<T>>(arr, low, high, pivot, inclusive);
+}
+#endif
+
+//     
+template<typename T>
+int vector_partition_instrumented(T arr[], int low, int high, T pivot, bool inclusive, OperationCounts& ops) {
+    ops.comparisons += high - low;
+    ops.memory_access += 2LL * (high - low);
+    if (ops.accessed_indices.size() < 10000) {
+        ops.accessed_indices.push_back(low);
+        ops.accessed_indices.push_back(high - 1);
+    }
+
+#if SIMD_SORT_AVAILABLE
+    switch (cpu_simd_level()) {
+        case SimdLevel::Avx512: return vector_partition_avx512(arr, low, high, pivot, inclusive);
+        case SimdLevel::Avx2: return vector_partition_avx2(arr, low, high, pivot, inclusive);
+        case SimdLevel::Scalar: break;
+    }
+#endif
+    return vector_partition_loop<ScalarPartition<T>>(arr, low, high, pivot, inclusive);
+}
+
+//      ( )
+template<typename T>
+void vector_quick_sort_instrumented(T arr[], int low, int high, int depth_limit, OperationCounts& ops) {
+    ops.add_memory(sizeof(int) * 4);
+
+    while (high - low + 1 > INTROSORT_THRESHOLD) {
+        if (depth_limit == 0) {
+            heap_sort_instrumented(arr + low, high - low + 1, ops);
+            ops.remove_memory(sizeof(int) * 4);
+            return;
+        }
+        depth_limit--;
+
+        int pivot_idx = choose_pivot_instrumented(arr, low, high, ops);
+        T pivot = arr[pivot_idx];
+        ops.memory_access++;
+
+        int split = vector_partition_instrumented(arr, low, high + 1, pivot, false, ops);
+
+        //   - :     ,  
+        if (split == low) {
+            low = vector_partition_instrumented(arr, low, high + 1, pivot, true, ops);
+            continue;
+        }
+
+        if (split - low < high - split) {
+            vector_quick_sort_instrumented(arr, low, split - 1, depth_limit, ops);
+            low = split;
+        } else {
+            vector_quick_sort_instrumented(arr, split, high, depth_limit, ops);
+            high = split - 1;
+        }
+    }
+
+    if (high > low) {
+        small_sort_instrumented(arr + low, high - low + 1, ops);
+    }
+
+    ops.remove_memory(sizeof(int) * 4);
+}
+
+//      ()
+template<typename T>
+void vector_quick_sort_instrumented(T arr[], int n, OperationCounts& ops) {
+    if (n < 2) return;
+    int depth_limit = 2 * static_cast<int>(log2(n));
+    vector_quick_sort_instrumented(arr, 0, n - 1, depth_limit, ops);
+}
+
+//      (BlockQuicksort)
+const int BLOCK_PARTITION_SIZE = 64;
+
+//  ,   arr[low] (   )
+template<typename T>
+int partition_equal_instrumented(T arr[], int low, int high, OperationCounts& ops) {
+    const T& pivot = arr[low];
+    int i = low + 1;
+    int j = high;
+
+    while (true) {
+        while (i <= j && !(pivot < arr[i])) {
+            ops.comparisons++;
+            ops.memory_access++;
+            i++;
+        }
+        while (i <= j && pivot < arr[j]) {
+            ops.comparisons++;
+            ops.memory_access++;
+            j--;
+        }
+        if (i >= j) break;
+
+        ops.swaps++;
+        ops.memory_access += 4;
+        swap(arr[i], arr[j]);
+        i++;
+        j--;
+    }
+
+    // arr[low..i)       
+    return i;
+}
+
+//    ,    (   arr[low])
+template<typename T>
+int block_partition_instrumented(T arr[], int low, int high, OperationCounts& ops) {
+    const T& pivot = arr[low];
+    unsigned char offsets_left[BLOCK_PARTITION_SIZE];
+    unsigned char offsets_right[BLOCK_PARTITION_SIZE];
+    int num_left = 0, num_right = 0;
+    int start_left = 0, start_right = 0;
+
+    //   - [l, r]
+    int l = low + 1;
+    int r = high;
+
+    while (r - l + 1 >= 2 * BLOCK_PARTITION_SIZE) {
+        //    ,   
+        if (num_left == 0) {
+            start_left = 0;
+            for (int i = 0; i < BLOCK_PARTITION_SIZE; i++) {
+                offsets_left[num_left] = static_cast<unsigned char>(i);
+                num_left += !(arr[l + i] < pivot);
+            }
+            ops.comparisons += BLOCK_PARTITION_SIZE;
+            ops.memory_access += BLOCK_PARTITION_SIZE;
+        }
+
+        //    ,   
+        if (num_right == 0) {
+            start_right = 0;
+            for (int i = 0; i < BLOCK_PARTITION_SIZE; i++) {
+                offsets_right[num_right] = static_cast<unsigned char>(i);
+                num_right += (arr[r - i] < pivot);
+            }
+            ops.comparisons += BLOCK_PARTITION_SIZE;
+            ops.memory_access += BLOCK_PARTITION_SIZE;
+        }
+
+        //   
+        int num = min(num_left, num_right);
+        for (int k = 0; k < num; k++) {
+            int left_idx = l + offsets_left[start_left + k];
+            int right_idx = r - offsets_right[start_right + k];
+            if (ops.accessed_indices.size() < 10000) {
+                ops.accessed_indices.push_back(left_idx);
+                ops.accessed_indices.push_back(right_idx);
+            }
+            swap(arr[left_idx], arr[right_idx]);
+        }
+        ops.swaps += num;
+        ops.memory_access += 4LL * num;
+
+        num_left -= num;
+        num_right -= num;
+        start_left += num;
+        start_right += num;
+
+        //       
+        if (num_left == 0) l += BLOCK_PARTITION_SIZE;
+        if (num_right == 0) r -= BLOCK_PARTITION_SIZE;
+    }
+
+    //  (   ) -  
+    int i = l;
+    int j = r;
+    while (true) {
+        while (i <= j && arr[i] < pivot) {
+            ops.comparisons++;
+            ops.memory_access++;
+            i++;
+        }
+        while (i <= j && !(arr[j] < pivot)) {
+            ops.comparisons++;
+            ops.memory_access++;
+            j--;
+        }
+        if (i >= j) break;
+
+        ops.swaps++;
+        ops.memory_access += 4;
+        swap(arr[i], arr[j]);
+        i++;
+        j--;
+    }
+
+    //     
+    int pivot_pos = i - 1;
+    ops.swaps++;
+    ops.memory_access += 4;
+    swap(arr[low], arr[pivot_pos]);
+    return pivot_pos;
+}
+
+//    ( )
+template<typename T>
+void block_quick_sort_instrumented(T arr[], int low, int high, int depth_limit, bool leftmost, OperationCounts& ops) {
+    size_t frame_memory = sizeof(int) * 4 + 2 * BLOCK_PARTITION_SIZE;
+    ops.add_memory(frame_memory);
+
+    while (high - low + 1 > INTROSORT_THRESHOLD) {
+        if (depth_limit == 0) {
+            heap_sort_instrumented(arr + low, high - low + 1, ops);
+            ops.remove_memory(frame_memory);
+            return;
+        }
+        depth_limit--;
+
+        int pivot_idx = choose_pivot_instrumented(arr, low, high, ops);
+        ops.swaps++;
+        ops.memory_access += 4;
+        swap(arr[low], arr[pivot_idx]);
+
+        //    -       
+        if (!leftmost) {
+            ops.comparisons++;
+            ops.memory_access += 2;
+            if (!(arr[low - 1] < arr[low])) {
+                low = partition_equal_instrumented(arr, low, high, ops);
+                continue;
+            }
+        }
+
+        int pivot_pos = block_partition_instrumented(arr, low, high, ops);
+
+        //    ,   
+        if (pivot_pos - low < high - pivot_pos) {
+            block_quick_sort_instrumented(arr, low, pivot_pos - 1, depth_limit, leftmost, ops);
+            low = pivot_pos + 1;
+            leftmost = false;
+        } else {
+            block_quick_sort_instrumented(arr, pivot_pos + 1, high, depth_limit, false, ops);
+            high = pivot_pos - 1;
+        }
+    }
+
+    if (high > low) {
+        insertion_sort_instrumented(arr + low, high - low + 1, ops);
+    }
+
+    ops.remove_memory(frame_memory);
+}
+
+//    ()
+template<typename T>
+void block_quick_sort_instrumented(T arr[], int n, OperationCounts& ops) {
+    if (n < 2) return;
+    int depth_limit = 2 * static_cast<int>(log2(n));
+    block_quick_sort_instrumented(arr, 0, n - 1, depth_limit, true, ops);
+}
+
+//      (work stealing)
+class WorkStealingPool {
+private:
+    struct WorkerQueue {
+        mutex queue_mutex;
+        deque<function<void()>> tasks;
+    };
+
+    vector<unique_ptr<WorkerQueue>> queues;
+    vector<thread> workers;
+    mutex state_mutex;
+    condition_variable work_available;
+    condition_variable all_done;
+    atomic<int> queued_tasks{0};
+    atomic<int> pending_tasks{0};
+    atomic<int> next_queue{0};
+    bool stopping = false;
+
+    inline static thread_local WorkStealingPool* current_pool = nullptr;
+    inline static thread_local int current_index = -1;
+
+    //      (LIFO)
+    bool pop_local(int index, function<void()>& task) {
+        WorkerQueue& queue = *queues[index];
+        lock_guard<mutex> lock(queue.queue_mutex);
+        if (queue.tasks.empty()) return false;
+        task = move(queue.tasks.back());
+        queue.tasks.pop_back();
+        queued_tasks--;
+        return true;
+    }
+
+    //      (FIFO -   )
+    bool steal(int index, function<void()>& task) {
+        int count = static_cast<int>(queues.size());
+        for (int offset = 1; offset < count; offset++) {
+            WorkerQueue& queue = *queues[(index + offset) % count];
+            lock_guard<mutex> lock(queue.queue_mutex);
+            if (queue.tasks.empty()) continue;
+            task = move(queue.tasks.front());
+            queue.tasks.pop_front();
+            queued_tasks--;
+            return true;
+        }
+        return false;
+    }
+
+    //      
+    void run_task(function<void()>& task) {
+        task();
+        if (--pending_tasks == 0) {
+            lock_guard<mutex> lock(state_mutex);
+            all_done.notify_all();
+        }
+    }
+
+    void worker_loop(int index) {
+        current_pool = this;
+        current_index = index;
+
+        while (true) {
+            function<void()> task;
+            if (pop_local(index, task) || steal(index, task)) {
+                run_task(task);
+                continue;
+            }
+
+            unique_lock<mutex> lock(state_mutex);
+            work_available.wait(lock, [this]() { return stopping || queued_tasks > 0; });
+            if (stopping) return;
+        }
+    }
+
+public:
+    explicit WorkStealingPool(int num_threads) {
+        if (num_threads < 1) num_threads = 1;
+        for (int i = 0; i < num_threads; i++) {
+            queues.push_back(make_unique<WorkerQueue>());
+        }
+        for (int i = 0; i < num_threads; i++) {
+            workers.emplace_back(&WorkStealingPool::worker_loop, this, i);
+        }
+    }
+
+    ~WorkStealingPool() {
+        {
+            lock_guard<mutex> lock(state_mutex);
+            stopping = true;
+        }
+        work_available.notify_all();
+        for (auto& worker : workers) {
+            worker.join();
+        }
+    }
+
+    //  :    -   ,  -  
+    void submit(function<void()> task) {
+        int index = worker_index();
+        if (index < 0) {
+            index = next_queue++ % size();
+        }
+
+        pending_tasks++;
+        {
+            lock_guard<mutex> lock(queues[index]->queue_mutex);
+            queues[index]->tasks.push_back(move(task));
+        }
+        {
+            lock_guard<mutex> lock(state_mutex);
+            queued_tasks++;
+        }
+        work_available.notify_one();
+    }
+
+    //    
+    void wait() {
+        unique_lock<mutex> lock(state_mutex);
+        all_done.wait(lock, [this]() { return pending_tasks == 0; });
+    }
+
+    //          
+    void wait_for(const atomic<int>& counter) {
+        int index = worker_index();
+        while (counter > 0) {
+            function<void()> task;
+            if (index >= 0 && (pop_local(index, task) || steal(index, task))) {
+                run_task(task);
+            } else {
+                this_thread::yield();
+            }
+        }
+    }
+
+    //     (-1  )
+    int worker_index() const {
+        return current_pool == this ? current_index : -1;
+    }
+
+    int size() const {
+        return static_cast<int>(queues.size());
+    }
+};
+
+//       
+inline void merge_worker_counts(OperationCounts& ops, const vector<OperationCounts>& worker_ops) {
+    for (const auto& worker : worker_ops) {
+        ops += worker;
+        for (int index : worker.accessed_indices) {
+            if (ops.accessed_indices.size() >= 10000) break;
+            ops.accessed_indices.push_back(index);
+        }
+    }
+}
+
+//       
+const int PARALLEL_QUICK_GRAIN = 4096;
+
+//    ( )
+template<typename T>
+void parallel_quick_sort_task(T arr[], int low, int high, int depth_limit,
+                              WorkStealingPool& pool, vector<OperationCounts>& worker_ops) {
+    OperationCounts& ops = worker_ops[pool.worker_index()];
+    ops.add_memory(sizeof(int) * 4);
+
+    while (high - low + 1 > PARALLEL_QUICK_GRAIN && depth_limit > 0) {
+        depth_limit--;
+
+        int pivot_idx = choose_pivot_instrumented(arr, low, high, ops);
+        T pivot = arr[pivot_idx];
+        ops.memory_access++;
+
+        int j = hoare_partition_instrumented(arr, low, high, pivot, ops);
+
+        //   -  ,    
+        pool.submit([arr, low, j, depth_limit, &pool, &worker_ops]() {
+            parallel_quick_sort_task(arr, low, j, depth_limit, pool, worker_ops);
+        });
+        low = j + 1;
+    }
+
+    //   (  ) -   
+    introsort_instrumented(arr, low, high, depth_limit, ops);
+
+    ops.remove_memory(sizeof(int) * 4);
+}
+
+//    ()
+template<typename T>
+void parallel_quick_sort_instrumented(T arr[], int n, int num_threads, OperationCounts& ops) {
+    if (n < 2) return;
+    if (num_threads <= 1 || n <= PARALLEL_QUICK_GRAIN) {
+        introsort_instrumented(arr, n, ops);
+        return;
+    }
+
+    WorkStealingPool pool(num_threads);
+    vector<OperationCounts> worker_ops(pool.size());
+    int depth_limit = 2 * static_cast<int>(log2(n));
+
+    pool.submit([arr, n, depth_limit, &pool, &worker_ops]() {
+        parallel_quick_sort_task(arr, 0, n - 1, depth_limit, pool, worker_ops);
+    });
+    pool.wait();
+
+    merge_worker_counts(ops, worker_ops);
+}
+
+//       
+const int PARALLEL_MERGE_GRAIN = 4096;
+
+//     (merge path):    A   diag 
+template<typename T>
+int merge_path_split_instrumented(const T a[], int n1, const T b[], int n2, int diag, OperationCounts& ops) {
+    int lo = max(0, diag - n2);
+    int hi = min(diag, n1);
+
+    while (lo < hi) {
+        int mid = lo + (hi - lo) / 2;
+        ops.comparisons++;
+        ops.memory_access += 2;
+        //     A   -  
+        if (!(b[diag - mid - 1] < a[mid])) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+
+    return lo;
+}
+
+//   arr[left..mid]  arr[mid+1..right]  
+template<typename T>
+void parallel_merge_instrumented(T arr[], T buffer[], int left, int mid, int right,
+                                 WorkStealingPool& pool, vector<OperationCounts>& worker_ops) {
+    T* a = arr + left;
+    T* b = arr + mid + 1;
+    int n1 = mid - left + 1;
+    int n2 = right - mid;
+    int total = n1 + n2;
+
+    //    
+    int chunks = min(pool.size(), max(1, total / PARALLEL_MERGE_GRAIN));
+
+    //     :   
+    //   ,       
+    OperationCounts& ops = worker_ops[pool.worker_index()];
+    vector<int> diag_split(chunks + 1);
+    vector<int> a_split(chunks + 1);
+    for (int c = 0; c <= chunks; c++) {
+        diag_split[c] = static_cast<int>(static_cast<long long>(total) * c / chunks);
+        a_split[c] = merge_path_split_instrumented(a, n1, b, n2, diag_split[c], ops);
+    }
+
+    atomic<int> remaining(chunks);
+    for (int c = 0; c < chunks; c++) {
+        int diag_begin = diag_split[c];
+        int a_begin = a_split[c];
+        int a_end = a_split[c + 1];
+        int b_begin = diag_begin - a_begin;
+        int b_end = diag_split[c + 1] - a_end;
+
+        pool.submit([=, &remaining, &pool, &worker_ops]() {
+            merge_range_instrumented(a + a_begin, a_end - a_begin, b + b_begin, b_end - b_begin,
+                                     buffer + left + diag_begin, worker_ops[pool.worker_index()]);
+            remaining--;
+        });
+    }
+    pool.wait_for(remaining);
+
+    //    
+    remaining = chunks;
+    for (int c = 0; c < chunks; c++) {
+        pool.submit([=, &remaining, &pool, &worker_ops]() {
+            OperationCounts& ops = worker_ops[pool.worker_index()];
+            int begin = left + static_cast<int>(static_cast<long long>(total) * c / chunks);
+            int end = left + static_cast<int>(static_cast<long long>(total) * (c + 1) / chunks);
+            for (int i = begin; i < end; i++) {
+                arr[i] = move(buffer[i]);
+            }
+            ops.memory_access += 2LL * (end - begin);
+            remaining--;
+        });
+    }
+    pool.wait_for(remaining);
+}
+
+//    ( )
+template<typename T>
+void parallel_merge_sort_task(T arr[], T buffer[], int left, int right,
+                              WorkStealingPool& pool, vector<OperationCounts>& worker_ops) {
+    if (right - left + 1 <= PARALLEL_MERGE_GRAIN) {
+        merge_sort_instrumented(arr, left, right, worker_ops[pool.worker_index()]);
+        return;
+    }
+
+    int mid = left + (right - left) / 2;
+
+    //   -  ,  -   
+    atomic<int> remaining(1);
+    pool.submit([arr, buffer, left, mid, &remaining, &pool, &worker_ops]() {
+        parallel_merge_sort_task(arr, buffer, left, mid, pool, worker_ops);
+        remaining--;
+    });
+    parallel_merge_sort_task(arr, buffer, mid + 1, right, pool, worker_ops);
+    pool.wait_for(remaining);
+
+    parallel_merge_instrumented(arr, buffer, left, mid, right, pool, worker_ops);
+}
+
+//    ()
+template<typename T>
+void parallel_merge_sort_instrumented(T arr[], int n, int num_threads, OperationCounts& ops) {
+    if (n < 2) return;
+    if (num_threads <= 1 || n <= PARALLEL_MERGE_GRAIN) {
+        merge_sort_instrumented(arr, n, ops);
+        return;
+    }
+
+    size_t buffer_memory = sizeof(T) * n;
+    ops.add_memory(buffer_memory);
+    T* buffer = new T[n];
+
+    WorkStealingPool pool(num_threads);
+    vector<OperationCounts> worker_ops(pool.size());
+
+    pool.submit([arr, buffer, n, &pool, &worker_ops]() {
+        parallel_merge_sort_task(arr, buffer, 0, n - 1, pool, worker_ops);
+    });
+    pool.wait();
+
+    delete[] buffer;
+    merge_worker_counts(ops, worker_ops);
+    ops.remove_memory(buffer_memory);
+}
+
+//      ( )
+const int SAMPLE_SORT_MIN_BUCKETS = 64;
+
+//    (    uint16_t    )
+const int SAMPLE_SORT_MAX_BUCKETS = 1024;
+
+//   :     
+const int SAMPLE_SORT_OVERSAMPLING = 16;
+
+//       
+const int SAMPLE_SORT_GRAIN = 1 << 16;
+
+//    :     
+template<typename T>
+struct SampleSortClassifier {
+    int buckets = 0;            //   ( )
+    int log_buckets = 0;        //  
+    bool equality_buckets = false; //    ,  
+    T* tree = nullptr;          // :  i,  2i  2i+1
+    T* splitters = nullptr;     //  
+
+    SampleSortClassifier() = default;
+    SampleSortClassifier(const SampleSortClassifier&) = delete;
+    SampleSortClassifier& operator=(const SampleSortClassifier&) = delete;
+
+    ~SampleSortClassifier() {
+        delete[] tree;
+        delete[] splitters;
+    }
+
+    //      (  )
+    void build_tree(int node, int low, int high) {
+        if (node >= buckets) return;
+        int mid = low + (high - low) / 2;
+        tree[node] = splitters[mid];
+        build_tree(2 * node, low, mid);
+        build_tree(2 * node + 1, mid + 1, high);
+    }
+
+    //  :         
+    int classify(const T& value) const {
+        int node = 1;
+        for (int level = 0; level < log_buckets; level++) {
+            node = 2 * node + static_cast<int>(tree[node] < value);
+        }
+        int bucket = node - buckets;
+        if (!equality_buckets) return bucket;
+
+        //  : value      
+        int is_equal = bucket < buckets - 1 && !(value < splitters[bucket]);
+        return 2 * bucket + is_equal;
+    }
+
+    int total_buckets() const {
+        return equality_buckets ? 2 * buckets : buckets;
+    }
+
+    //    
+    bool needs_sorting(int bucket) const {
+        return !equality_buckets || bucket % 2 == 0;
+    }
+};
+
+//         
+inline double elapsed_phase_seconds(chrono::high_resolution_clock::time_point& mark) {
+    auto now = chrono::high_resolution_clock::now();
+    double seconds = chrono::duration<double>(now - mark).count();
+    mark = now;
+    return seconds;
+}
+
+//   :  ,   ,
+//         
+template<typename T>
+void parallel_sample_sort_instrumented(T arr[], int n, int num_threads, OperationCounts& ops) {
+    if (n < 2) return;
+    if (n <= SAMPLE_SORT_GRAIN) {
+        introsort_instrumented(arr, n, ops);
+        return;
+    }
+
+    WorkStealingPool pool(num_threads);
+    vector<OperationCounts> worker_ops(pool.size());
+    int threads = pool.size();
+    auto phase_mark = chrono::high_resolution_clock::now();
+
+    //  1:   
+    SampleSortClassifier<T> classifier;
+    classifier.buckets = SAMPLE_SORT_MIN_BUCKETS;
+    while (classifier.buckets < 4 * threads && classifier.buckets < SAMPLE_SORT_MAX_BUCKETS / 2) {
+        classifier.buckets *= 2;
+    }
+    classifier.log_buckets = static_cast<int>(log2(classifier.buckets));
+
+    int sample_size = classifier.buckets * SAMPLE_SORT_OVERSAMPLING - 1;
+    T* sample = new T[sample_size];
+    ops.add_memory(sizeof(T) * sample_size);
+    mt19937 sample_rng(12345);
+    uniform_int_distribution<int> sample_index(0, n - 1);
+    for (int i = 0; i < sample_size; i++) {
+        sample[i] = arr[sample_index(sample_rng)];
+    }
+    ops.memory_access += sample_size;
+    introsort_instrumented(sample, sample_size, ops);
+
+    classifier.splitters = new T[classifier.buckets - 1];
+    classifier.tree = new T[classifier.buckets];
+    for (int i = 0; i < classifier.buckets - 1; i++) {
+        classifier.splitters[i] = sample[(i + 1) * SAMPLE_SORT_OVERSAMPLING - 1];
+        if (i > 0 && !(classifier.splitters[i - 1] < classifier.splitters[i])) {
+            classifier.equality_buckets = true;
+        }
+    }
+    classifier.build_tree(1, 0, classifier.buckets - 1);
+    delete[] sample;
+    ops.remove_memory(sizeof(T) * sample_size);
+
+    //   :   , ,   
+    int total_buckets = classifier.total_buckets();
+    size_t buffer_memory = sizeof(T) * n + sizeof(uint16_t) * n +
+                           sizeof(int) * static_cast<size_t>(threads) * total_buckets +
+                           sizeof(T) * 2 * classifier.buckets;
+    ops.add_memory(buffer_memory);
+    ops.add_phase_time("sample", elapsed_phase_seconds(phase_mark));
+
+    //  2:      
+    uint16_t* bucket_of = new uint16_t[n];
+    vector<vector<int>> offsets(threads, vector<int>(total_buckets, 0));
+    for (int t = 0; t < threads; t++) {
+        pool.submit([&, t]() {
+            OperationCounts& local = worker_ops[pool.worker_index()];
+            int begin = static_cast<int>(static_cast<long long>(n) * t / threads);
+            int end = static_cast<int>(static_cast<long long>(n) * (t + 1) / threads);
+            vector<int>& histogram = offsets[t];
+            for (int i = begin; i < end; i++) {
+                int bucket = classifier.classify(arr[i]);
+                bucket_of[i] = static_cast<uint16_t>(bucket);
+                histogram[bucket]++;
+            }
+            local.comparisons += static_cast<long long>(end - begin) *
+                                 (classifier.log_buckets + (classifier.equality_buckets ? 1 : 0));
+            local.memory_access += 2LL * (end - begin);
+        });
+    }
+    pool.wait();
+
+    //  :   ,   -   
+    vector<int> bucket_start(total_buckets + 1, 0);
+    int position = 0;
+    for (int b = 0; b < total_buckets; b++) {
+        bucket_start[b] = position;
+        for (int t = 0; t < threads; t++) {
+            int count = offsets[t][b];
+            offsets[t][b] = position;
+            position += count;
+        }
+    }
+    bucket_start[total_buckets] = position;
+    ops.add_phase_time("classify", elapsed_phase_seconds(phase_mark));
+
+    //  3:      
+    T* buffer = new T[n];
+    for (int t = 0; t < threads; t++) {
+        pool.submit([&, t]() {
+            OperationCounts& local = worker_ops[pool.worker_index()];
+            int begin = static_cast<int>(static_cast<long long>(n) * t / threads);
+            int end = static_cast<int>(static_cast<long long>(n) * (t + 1) / threads);
+            vector<int>& cursor = offsets[t];
+            for (int i = begin; i < end; i++) {
+                buffer[cursor[bucket_of[i]]++] = move(arr[i]);
+            }
+            local.memory_access += 3LL * (end - begin);
+        });
+    }
+    pool.wait();
+    ops.add_phase_time("scatter", elapsed_phase_seconds(phase_mark));
+
+    //  4:        
+    for (int b = 0; b < total_buckets; b++) {
+        int begin = bucket_start[b];
+        int end = bucket_start[b + 1];
+        if (begin == end) continue;
+
+        bool sort_bucket = classifier.needs_sorting(b);
+        pool.submit([&, begin, end, sort_bucket]() {
+            OperationCounts& local = worker_ops[pool.worker_index()];
+            if (sort_bucket) {
+                introsort_instrumented(buffer + begin, end - begin, local);
+            }
+            for (int i = begin; i < end; i++) {
+                arr[i] = move(buffer[i]);
+            }
+            local.memory_access += 2LL * (end - begin);
+        });
+    }
+    pool.wait();
+    ops.add_phase_time("sort", elapsed_phase_seconds(phase_mark));
+
+    delete[] buffer;
+    delete[] bucket_of;
+    merge_worker_counts(ops, worker_ops);
+    ops.remove_memory(buffer_memory);
+}
+
+//      
+const int RADIX_BITS = 8;
+const int RADIX_BUCKETS = 1 << RADIX_BITS;
+
+// ,      
+template<typename T>
+constexpr bool is_radix_sortable_v = is_arithmetic_v<T> && !is_same_v<T, bool>;
+
+//        
+template<typename T>
+auto radix_key(T value) {
+    if constexpr (is_floating_point_v<T>) {
+        using Key = conditional_t<sizeof(T) == 8, uint64_t, uint32_t>;
+        const Key sign_bit = Key(1) << (sizeof(T) * 8 - 1);
+        Key bits;
+        memcpy(&bits, &value, sizeof(T));
+        //   -   ,  -   
+        return (bits & sign_bit) ? Key(~bits) : Key(bits | sign_bit);
+    } else if constexpr (is_signed_v<T>) {
+        using Key = make_unsigned_t<T>;
+        const Key sign_bit = Key(1) << (sizeof(T) * 8 - 1);
+        return Key(static_cast<Key>(value) ^ sign_bit);
+    } else {
+        return value;
+    }
+}
+
+//   LSD (  )
+template<typename T>
+void radix_sort_instrumented(T arr[], int n, OperationCounts& ops) {
+    if (n < 2) return;
+
+    using Key = decltype(radix_key(arr[0]));
+    const int digits = static_cast<int>(sizeof(Key) * 8 / RADIX_BITS);
+
+    size_t buffer_memory = sizeof(T) * n + sizeof(int) * RADIX_BUCKETS * digits;
+    ops.add_memory(buffer_memory);
+
+    //      
+    vector<int> counts(RADIX_BUCKETS * digits, 0);
+    for (int i = 0; i < n; i++) {
+        Key key = radix_key(arr[i]);
+        for (int d = 0; d < digits; d++) {
+            counts[d * RADIX_BUCKETS + ((key >> (d * RADIX_BITS)) & (RADIX_BUCKETS - 1))]++;
+        }
+    }
+    ops.memory_access += n;
+    ops.passes++;
+
+    T* buffer = new T[n];
+    T* src = arr;
+    T* dst = buffer;
+
+    for (int d = 0; d < digits; d++) {
+        int shift = d * RADIX_BITS;
+        int* count = &counts[d * RADIX_BUCKETS];
+
+        //  ,      
+        if (count[(radix_key(src[0]) >> shift) & (RADIX_BUCKETS - 1)] == n) {
+            continue;
+        }
+
+        //   -   
+        int offset = 0;
+        for (int b = 0; b < RADIX_BUCKETS; b++) {
+            int bucket_size = count[b];
+            count[b] = offset;
+            offset += bucket_size;
+        }
+
+        //    
+        for (int i = 0; i < n; i++) {
+            int bucket = (radix_key(src[i]) >> shift) & (RADIX_BUCKETS - 1);
+            if (ops.accessed_indices.size() < 10000) {
+                ops.accessed_indices.push_back(count[bucket]);
+            }
+            dst[count[bucket]++] = move(src[i]);
+        }
+        ops.swaps += n;
+        ops.memory_access += 2LL * n;
+        ops.passes++;
+
+        swap(src, dst);
+    }
+
+    if (src != arr) {
+        for (int i = 0; i < n; i++) {
+            arr[i] = move(src[i]);
+        }
+        ops.memory_access += 2LL * n;
+    }
+
+    delete[] buffer;
+    ops.remove_memory(buffer_memory);
+}
+
+//       
+const int PARALLEL_RADIX_GRAIN = 1 << 16;
+
+//       (  )
+const int PARALLEL_RADIX_LINE_BYTES = 64;
+
+//     :       
+//     ,      256  
+template<typename T>
+struct alignas(PARALLEL_RADIX_LINE_BYTES) RadixWriteCombiningLine {
+    static constexpr int capacity = max(1, PARALLEL_RADIX_LINE_BYTES / static_cast<int>(sizeof(T)));
+    T items[capacity];
+};
+
+//   shift    [begin, end)
+template<typename T>
+void radix_histogram(const T arr[], int begin, int end, int shift, int* count) {
+    for (int i = begin; i < end; i++) {
+        count[(radix_key(arr[i]) >> shift) & (RADIX_BUCKETS - 1)]++;
+    }
+}
+
+//    LSD:     ,
+//    (  ,  -   )  
+//       ,    
+//  .         64 , 
+//              
+template<typename T>
+void parallel_radix_sort_instrumented(T arr[], int n, int num_threads, OperationCounts& ops) {
+    if (n < 2) return;
+    if (n <= PARALLEL_RADIX_GRAIN) {
+        radix_sort_instrumented(arr, n, ops);
+        return;
+    }
+
+    using Key = decltype(radix_key(arr[0]));
+    using Line = RadixWriteCombiningLine<T>;
+    const int digits = static_cast<int>(sizeof(Key) * 8 / RADIX_BITS);
+
+    WorkStealingPool pool(num_threads);
+    vector<OperationCounts> worker_ops(pool.size());
+    int threads = pool.size();
+    auto phase_mark = chrono::high_resolution_clock::now();
+
+    size_t buffer_memory = sizeof(T) * n +
+                           static_cast<size_t>(threads) * (sizeof(int) * RADIX_BUCKETS * (digits + 3) +
+                                                           sizeof(Line) * RADIX_BUCKETS);
+    ops.add_memory(buffer_memory);
+
+    //    (     )
+    vector<int> chunk_start(threads + 1);
+    for (int t = 0; t <= threads; t++) {
+        chunk_start[t] = static_cast<int>(static_cast<long long>(n) * t / threads);
+    }
+
+    //      ;     
+    vector<vector<int>> counts(threads, vector<int>(RADIX_BUCKETS * digits, 0));
+    for (int t = 0; t < threads; t++) {
+        pool.submit([&, t]() {
+            OperationCounts& local = worker_ops[pool.worker_index()];
+            int* count = counts[t].data();
+            for (int i = chunk_start[t]; i < chunk_start[t + 1]; i++) {
+                Key key = radix_key(arr[i]);
+                for (int d = 0; d < digits; d++) {
+                    count[d * RADIX_BUCKETS + ((key >> (d * RADIX_BITS)) & (RADIX_BUCKETS - 1))]++;
+                }
+            }
+            local.memory_access += chunk_start[t + 1] - chunk_start[t];
+        });
+    }
+    pool.wait();
+    ops.passes++;
+    ops.add_phase_time("histogram", elapsed_phase_seconds(phase_mark));
+
+    T* buffer = new T[n];
+    T* src = arr;
+    T* dst = buffer;
+    bool layout_changed = false;
+    vector<vector<int>> offsets(threads, vector<int>(RADIX_BUCKETS));
+
+    for (int d = 0; d < digits; d++) {
+        int shift = d * RADIX_BITS;
+
+        //  ,      
+        int first_bucket = static_cast<int>((radix_key(src[0]) >> shift) & (RADIX_BUCKETS - 1));
+        int same_digit = 0;
+        for (int t = 0; t < threads; t++) {
+            same_digit += counts[t][d * RADIX_BUCKETS + first_bucket];
+        }
+        if (same_digit == n) continue;
+
+        //        - 
+        //   
+        if (layout_changed) {
+            for (int t = 0; t < threads; t++) {
+                pool.submit([&, t, shift]() {
+                    OperationCounts& local = worker_ops[pool.worker_index()];
+                    int* count = &counts[t][d * RADIX_BUCKETS];
+                    fill(count, count + RADIX_BUCKETS, 0);
+                    radix_histogram(src, chunk_start[t], chunk_start[t + 1], shift, count);
+                    local.memory_access += chunk_start[t + 1] - chunk_start[t];
+                });
+            }
+            pool.wait();
+            ops.add_phase_time("histogram", elapsed_phase_seconds(phase_mark));
+        }
+
+        int position = 0;
+        for (int b = 0; b < RADIX_BUCKETS; b++) {
+            for (int t = 0; t < threads; t++) {
+                offsets[t][b] = position;
+                position += counts[t][d * RADIX_BUCKETS + b];
+            }
+        }
+
+        for (int t = 0; t < threads; t++) {
+            pool.submit([&, t, shift]() {
+                OperationCounts& local = worker_ops[pool.worker_index()];
+                int begin = chunk_start[t];
+                int end = chunk_start[t + 1];
+                vector<int>& cursor = offsets[t];
+                vector<Line> lines(RADIX_BUCKETS);
+                vector<int> filled(RADIX_BUCKETS, 0);
+                vector<int> limit(RADIX_BUCKETS);
+
+                //     -      
+                for (int b = 0; b < RADIX_BUCKETS; b++) {
+                    size_t misalignment = reinterpret_cast<uintptr_t>(dst + cursor[b]) % PARALLEL_RADIX_LINE_BYTES;
+                    limit[b] = Line::capacity - static_cast<int>(misalignment / sizeof(T));
+                }
+
+                for (int i = begin; i < end; i++) {
+                    T value = src[i];
+                    int bucket = static_cast<int>((radix_key(value) >> shift) & (RADIX_BUCKETS - 1));
+                    int slot = filled[bucket];
+                    lines[bucket].items[slot] = value;
+                    if (slot + 1 < limit[bucket]) {
+                        filled[bucket] = slot + 1;
+                    } else if (limit[bucket] == Line::capacity) {
+                        //   :   
+                        memcpy(dst + cursor[bucket], lines[bucket].items, sizeof(lines[bucket].items));
+                        cursor[bucket] += Line::capacity;
+                        filled[bucket] = 0;
+                    } else {
+                        memcpy(dst + cursor[bucket], lines[bucket].items, sizeof(T) * limit[bucket]);
+                        cursor[bucket] += limit[bucket];
+                        filled[bucket] = 0;
+                        limit[bucket] = Line::capacity;
+                    }
+                }
+
+                //   
+                for (int b = 0; b < RADIX_BUCKETS; b++) {
+                    memcpy(dst + cursor[b], lines[b].items, sizeof(T) * filled[b]);
+                }
+
+                local.swaps += end - begin;
+                local.memory_access += 3LL * (end - begin);
+            });
+        }
+        pool.wait();
+        ops.passes++;
+        ops.add_phase_time("scatter", elapsed_phase_seconds(phase_mark));
+
+        swap(src, dst);
+        layout_changed = true;
+    }
+
+    if (src != arr) {
+        for (int t = 0; t < threads; t++) {
+            pool.submit([&, t]() {
+                OperationCounts& local = worker_ops[pool.worker_index()];
+                int begin = chunk_start[t];
+                int end = chunk_start[t + 1];
+                memcpy(arr + begin, src + begin, sizeof(T) * (end - begin));
+                local.memory_access += 2LL * (end - begin);
+            });
+        }
+        pool.wait();
+        ops.add_phase_time("copy", elapsed_phase_seconds(phase_mark));
+    }
+
+    delete[] buffer;
+    merge_worker_counts(ops, worker_ops);
+    ops.remove_memory(buffer_memory);
+}
+
+//         ( )
+const int STRING_SORT_THRESHOLD = 16;
+
+//       (string    )
+template<typename T>
+constexpr bool is_string_like_v = is_same_v<T, string> || is_same_v<T, string_view>;
+
+//     depth (0 -  ,    + 1)
+template<typename S>
+int string_char_at(const S& s, size_t depth, OperationCounts& ops) {
+    ops.char_inspections++;
+    return depth < s.size() ? static_cast<unsigned char>(s[depth]) + 1 : 0;
+}
+
+//       depth,    depth
+template<typename S>
+int compare_strings_from(const S& a, const S& b, size_t depth, OperationCounts& ops) {
+    ops.comparisons++;
+    size_t len = min(a.size(), b.size());
+    for (size_t d = depth; d < len; d++) {
+        ops.char_inspections += 2;
+        if (a[d] != b[d]) {
+            return static_cast<unsigned char>(a[d]) < static_cast<unsigned char>(b[d]) ? -1 : 1;
+        }
+    }
+    if (a.size() == b.size()) return 0;
+    return a.size() < b.size() ? -1 : 1;
+}
+
+//        depth
+template<typename S>
+void string_insertion_sort_instrumented(S arr[], int low, int high, size_t depth, OperationCounts& ops) {
+    for (int i = low + 1; i < high; i++) {
+        S key = move(arr[i]);
+        ops.memory_access++;
+        int j = i - 1;
+        while (j >= low && compare_strings_from(arr[j], key, depth, ops) > 0) {
+            arr[j + 1] = move(arr[j]);
+            ops.memory_access += 2;
+            ops.swaps++;
+            j--;
+        }
+        arr[j + 1] = move(key);
+        ops.memory_access++;
+    }
+}
+
+//  " " ( ): arr[low..high),    depth
+template<typename S>
+void american_flag_sort_instrumented(S arr[], int low, int high, size_t depth, OperationCounts& ops) {
+    if (high - low <= STRING_SORT_THRESHOLD) {
+        string_insertion_sort_instrumented(arr, low, high, depth, ops);
+        return;
+    }
+
+    const int buckets = 257;
+    size_t frame_memory = sizeof(int) * buckets * 2;
+    ops.add_memory(frame_memory);
+
+    //        depth
+    vector<int> bucket_end(buckets, 0);
+    for (int i = low; i < high; i++) {
+        bucket_end[string_char_at(arr[i], depth, ops)]++;
+        ops.memory_access++;
+    }
+
+    vector<int> next(buckets);
+    int offset = low;
+    for (int b = 0; b < buckets; b++) {
+        next[b] = offset;
+        offset += bucket_end[b];
+        bucket_end[b] = offset;
+    }
+
+    //     
+    for (int b = 0; b < buckets; b++) {
+        while (next[b] < bucket_end[b]) {
+            int c = string_char_at(arr[next[b]], depth, ops);
+            while (c != b) {
+                if (ops.accessed_indices.size() < 10000) {
+                    ops.accessed_indices.push_back(next[c]);
+                }
+                ops.swaps++;
+                ops.memory_access += 4;
+                swap(arr[next[b]], arr[next[c]++]);
+                c = string_char_at(arr[next[b]], depth, ops);
+            }
+            next[b]++;
+        }
+    }
+    ops.passes++;
+
+    //    ( 0 -  ,  )
+    int start = bucket_end[0];
+    for (int b = 1; b < buckets; b++) {
+        if (bucket_end[b] - start > 1) {
+            american_flag_sort_instrumented(arr, start, bucket_end[b], depth + 1, ops);
+        }
+        start = bucket_end[b];
+    }
+
+    ops.remove_memory(frame_memory);
+}
+
+//  " " ()
+template<typename S>
+void american_flag_sort_instrumented(S arr[], int n, OperationCounts& ops) {
+    american_flag_sort_instrumented(arr, 0, n, 0, ops);
+}
+
+//      
+template<typename S>
+void multikey_swap_instrumented(S arr[], int a, int b, OperationCounts& ops) {
+    if (ops.accessed_indices.size() < 10000) {
+        ops.accessed_indices.push_back(b);
+    }
+    ops.swaps++;
+    ops.memory_access += 4;
+    swap(arr[a], arr[b]);
+}
+
+//    - ( ): arr[low..high),
+//    depth.       depth;  depth
+//     ,      
+template<typename S>
+void multikey_quicksort_instrumented(S arr[], int low, int high, size_t depth, OperationCounts& ops) {
+    ops.add_memory(sizeof(int) * 6);
+
+    while (high - low > STRING_SORT_THRESHOLD) {
+        //   -   ,    
+        int mid = low + (high - low) / 2;
+        int a = string_char_at(arr[low], depth, ops);
+        int b = string_char_at(arr[mid], depth, ops);
+        int c = string_char_at(arr[high - 1], depth, ops);
+        int pivot = max(min(a, b), min(max(a, b), c));
+
+        //  : [low, lt) < pivot, [lt, gt) == pivot, [gt, high) > pivot
+        int lt = low;
+        int gt = high;
+        int i = low;
+        while (i < gt) {
+            int ch = string_char_at(arr[i], depth, ops);
+            ops.memory_access++;
+            if (ch < pivot) {
+                multikey_swap_instrumented(arr, lt++, i++, ops);
+            } else if (ch > pivot) {
+                multikey_swap_instrumented(arr, i, --gt, ops);
+            } else {
+                i++;
+            }
+        }
+        ops.passes++;
+
+        //      (pivot 0 -  ,  )
+        if (pivot != 0 && gt - lt > 1) {
+            multikey_quicksort_instrumented(arr, lt, gt, depth + 1, ops);
+        }
+
+        //      ,    -  O(log n)
+        if (lt - low < high - gt) {
+            multikey_quicksort_instrumented(arr, low, lt, depth, ops);
+            low = gt;
+        } else {
+            multikey_quicksort_instrumented(arr, gt, high, depth, ops);
+            high = lt;
+        }
+    }
+
+    if (high - low > 1) {
+        string_insertion_sort_instrumented(arr, low, high, depth, ops);
+    }
+
+    ops.remove_memory(sizeof(int) * 6);
+}
+
+//    ()
+template<typename S>
+void multikey_quicksort_instrumented(S arr[], int n, OperationCounts& ops) {
+    multikey_quicksort_instrumented(arr, 0, n, 0, ops);
+}
+
+//         
+const int COUNTING_SORT_MAX_KEYS = 256;
+
+//      
+template<typename T>
+void counting_sort_instrumented(T arr[], int n, OperationCounts& ops) {
+    if (n < 2) return;
+
+    if constexpr (is_same_v<T, bool>) {
+        //  :      
+        int true_count = 0;
+        for (int i = 0; i < n; i++) {
+            true_count += arr[i] ? 1 : 0;
+        }
+        for (int i = 0; i < n; i++) {
+            arr[i] = (i >= n - true_count);
+        }
+        ops.memory_access += 2LL * n;
+        ops.passes += 2;
+    } else if constexpr (is_integral_v<T>) {
+        //      
+        T min_value = arr[0];
+        T max_value = arr[0];
+        for (int i = 1; i < n; i++) {
+            ops.comparisons += 2;
+            if (arr[i] < min_value) min_value = arr[i];
+            if (arr[i] > max_value) max_value = arr[i];
+        }
+        ops.memory_access += n;
+        ops.passes++;
+
+        long long range = static_cast<long long>(max_value) - static_cast<long long>(min_value) + 1;
+        if (range > max(COUNTING_SORT_MAX_KEYS, n)) {
+            //    -   
+            bottom_up_merge_sort_instrumented(arr, n, ops);
+            return;
+        }
+
+        size_t counts_memory = sizeof(int) * range;
+        ops.add_memory(counts_memory);
+
+        vector<int> counts(range, 0);
+        for (int i = 0; i < n; i++) {
+            counts[arr[i] - min_value]++;
+        }
+        ops.memory_access += n;
+
+        int k = 0;
+        for (long long key = 0; key < range; key++) {
+            for (int c = 0; c < counts[key]; c++) {
+                if (ops.accessed_indices.size() < 10000) {
+                    ops.accessed_indices.push_back(k);
+                }
+                arr[k++] = static_cast<T>(min_value + key);
+            }
+        }
+        ops.memory_access += n;
+        ops.passes += 2;
+
+        ops.remove_memory(counts_memory);
+    } else {
+        //        
+        vector<T> keys;
+        auto find_key = [&keys, &ops](const T& value) {
+            int lo = 0;
+            int hi = static_cast<int>(keys.size());
+            while (lo < hi) {
+                int mid = lo + (hi - lo) / 2;
+                ops.comparisons++;
+                if (keys[mid] < value) lo = mid + 1;
+                else hi = mid;
+            }
+            return lo;
+        };
+
+        size_t keys_memory = sizeof(T) * COUNTING_SORT_MAX_KEYS + sizeof(uint8_t) * n;
+        ops.add_memory(keys_memory);
+
+        //      
+        for (int i = 0; i < n; i++) {
+            int pos = find_key(arr[i]);
+            ops.memory_access++;
+            ops.comparisons++;
+            if (pos == static_cast<int>(keys.size()) || arr[i] < keys[pos]) {
+                if (static_cast<int>(keys.size()) == COUNTING_SORT_MAX_KEYS) {
+                    //     -   
+                    ops.remove_memory(keys_memory);
+                    bottom_up_merge_sort_instrumented(arr, n, ops);
+                    return;
+                }
+                keys.insert(keys.begin() + pos, arr[i]);
+            }
+        }
+        ops.passes++;
+
+        //     
+        vector<uint8_t> key_index(n);
+        vector<int> offsets(keys.size() + 1, 0);
+        for (int i = 0; i < n; i++) {
+            key_index[i] = static_cast<uint8_t>(find_key(arr[i]));
+            offsets[key_index[i] + 1]++;
+        }
+        ops.memory_access += n;
+        ops.passes++;
+
+        //     
+        size_t buffer_memory = sizeof(T) * n;
+        ops.add_memory(buffer_memory);
+
+        for (size_t k = 1; k < offsets.size(); k++) {
+            offsets[k] += offsets[k - 1];
+        }
+
+        T* buffer = new T[n];
+        for (int i = 0; i < n; i++) {
+            int pos = offsets[key_index[i]]++;
+            if (ops.accessed_indices.size() < 10000) {
+                ops.accessed_indices.push_back(pos);
+            }
+            buffer[pos] = move(arr[i]);
+        }
+        for (int i = 0; i < n; i++) {
+            arr[i] = move(buffer[i]);
+        }
+        ops.swaps += n;
+        ops.memory_access += 4LL * n;
+        ops.passes += 2;
+
+        delete[] buffer;
+        ops.remove_memory(buffer_memory);
+        ops.remove_memory(keys_memory);
+    }
+}
+
+//   k-  ( ):   arr[k]   
+// ,   ,   .   -   
+template<typename T>
+void introselect_instrumented(T arr[], int low, int high, int k, int depth_limit, OperationCounts& ops) {
+    while (high - low + 1 > INTROSORT_THRESHOLD) {
+        if (depth_limit == 0) {
+            heap_sort_instrumented(arr + low, high - low + 1, ops);
+            return;
+        }
+        depth_limit--;
+
+        int pivot_idx = choose_pivot_instrumented(arr, low, high, ops);
+        T pivot = arr[pivot_idx];
+        ops.memory_access++;
+
+        //     ,   k
+        int j = hoare_partition_instrumented(arr, low, high, pivot, ops);
+        if (k <= j) {
+            high = j;
+        } else {
+            low = j + 1;
+        }
+    }
+
+    if (high > low) {
+        insertion_sort_instrumented(arr + low, high - low + 1, ops);
+    }
+}
+
+//   k-  (,  nth_element)
+template<typename T>
+void introselect_instrumented(T arr[], int n, int k, OperationCounts& ops) {
+    if (n < 2 || k < 0 || k >= n) return;
+    ops.add_memory(sizeof(int) * 4);
+    int depth_limit = 2 * static_cast<int>(log2(n));
+    introselect_instrumented(arr, 0, n - 1, k, depth_limit, ops);
+    ops.remove_memory(sizeof(int) * 4);
+}
+
+//   :  k  ,  -   
+template<typename T>
+void partial_sort_heap_instrumented(T arr[], int n, int k, OperationCounts& ops) {
+    k = min(k, n);
+    if (k <= 0) return;
+    ops.add_memory(sizeof(T) + sizeof(int) * 3);
+
+    //     k 
+    for (int i = k / 2 - 1; i >= 0; i--) {
+        T value = move(arr[i]);
+        bottom_up_sift_down_instrumented(arr, k, i, move(value), ops);
+    }
+
+    //      
+    for (int i = k; i < n; i++) {
+        ops.comparisons++;
+        ops.memory_access += 2;
+        if (arr[i] < arr[0]) {
+            T value = move(arr[i]);
+            arr[i] = move(arr[0]);
+            ops.swaps++;
+            ops.memory_access += 4;
+            bottom_up_sift_down_instrumented(arr, k, 0, move(value), ops);
+        }
+    }
+
+    //  
+    for (int end = k - 1; end > 0; end--) {
+        T value = move(arr[end]);
+        arr[end] = move(arr[0]);
+        ops.swaps++;
+        ops.memory_access += 4;
+        bottom_up_sift_down_instrumented(arr, end, 0, move(value), ops);
+    }
+
+    ops.remove_memory(sizeof(T) + sizeof(int) * 3);
+}
+
+//   : introselect  k ,   
+template<typename T>
+void partial_sort_select_instrumented(T arr[], int n, int k, OperationCounts& ops) {
+    k = min(k, n);
+    if (k <= 0) return;
+    if (k < n) {
+        introselect_instrumented(arr, n, k - 1, ops);
+    }
+    introsort_instrumented(arr, k, ops);
+}
+
+//   k :       ,
+//  ( )   out,  O(k)
+template<typename T>
+int streaming_top_k_instrumented(const T arr[], int n, int k, T out[], OperationCounts& ops) {
+    k = min(k, n);
+    if (k <= 0) return 0;
+    ops.add_memory(sizeof(T) * k);
+
+    int size = 0;
+    for (int i = 0; i < n; i++) {
+        ops.memory_access++;
+        if (ops.accessed_indices.size() < 10000) {
+            ops.accessed_indices.push_back(i);
+        }
+
+        if (size < k) {
+            //  :   
+            int hole = size++;
+            while (hole > 0) {
+                int parent = (hole - 1) / 2;
+                ops.comparisons++;
+                ops.memory_access++;
+                if (!(out[parent] < arr[i])) break;
+                out[hole] = move(out[parent]);
+                ops.memory_access += 2;
+                hole = parent;
+            }
+            out[hole] = arr[i];
+            ops.memory_access++;
+            continue;
+        }
+
+        ops.comparisons++;
+        ops.memory_access++;
+        if (arr[i] < out[0]) {
+            bottom_up_sift_down_instrumented(out, k, 0, T(arr[i]), ops);
+        }
+    }
+
+    for (int end = k - 1; end > 0; end--) {
+        T value = move(out[end]);
+        out[end] = move(out[0]);
+        ops.swaps++;
+        ops.memory_access += 4;
+        bottom_up_sift_down_instrumented(out, end, 0, move(value), ops);
+    }
+
+    ops.remove_memory(sizeof(T) * k);
+    return k;
+}
+
+//   ( )  k- .  1..k-1  
+//  , tree[0] - .     
+//        :  ceil(log2 k)   .
+// head(i)     i;     ,
+//   
+template<typename T, typename HeadOf>
+class LoserTree {
+private:
+    int k;
+    vector<int> tree;
+    vector<char> active;
+    HeadOf head;
+    OperationCounts& ops;
+
+    //  a   a_key  b:    .
+    //  (, )      
+    //   -     
+    bool beats(int a, const T* a_key, int b, const T* b_key, long long& compared) {
+        if (!active[a]) return false;
+        if (!active[b]) return true;
+        compared++;
+        bool a_first = a < b;
+        const T* keys[2] = {a_key, b_key};
+        return (*keys[a_first] < *keys[!a_first]) != a_first;
+    }
+
+public:
+    // active[i] = false  ,    
+    LoserTree(vector<char> initially_active, HeadOf head_of, OperationCounts& ops_ref)
+        : k(static_cast<int>(initially_active.size())), tree(max(k, 1), 0),
+          active(move(initially_active)), head(head_of), ops(ops_ref) {
+        if (k == 0) {
+            active.push_back(0);
+            k = 1;
+        }
+        ops.add_memory(sizeof(int) * tree.size() + active.size());
+
+        //  k..2k-1,     
+        vector<int> winners(2 * k);
+        for (int leaf = 0; leaf < k; leaf++) {
+            winners[k + leaf] = leaf;
+        }
+        long long compared = 0;
+        for (int node = k - 1; node >= 1; node--) {
+            int a = winners[2 * node];
+            int b = winners[2 * node + 1];
+            bool a_wins = beats(a, active[a] ? &head(a) : nullptr, b, active[b] ? &head(b) : nullptr, compared);
+            tree[node] = a_wins ? b : a;
+            winners[node] = a_wins ? a : b;
+        }
+        tree[0] = k > 1 ? winners[1] : 0;
+        ops.comparisons += compared;
+        ops.memory_access += 2 * compared;
+    }
+
+    ~LoserTree() {
+        ops.remove_memory(sizeof(int) * tree.size() + active.size());
+    }
+
+    //    
+    int winner() const {
+        return tree[0];
+    }
+
+    //   
+    bool empty() const {
+        return !active[tree[0]];
+    }
+
+    //       .  
+    //       ,      
+    //   .        
+    void replay() {
+        long long compared = 0;
+        int winner = tree[0];
+        const T* winner_key = active[winner] ? &head(winner) : nullptr;
+        for (int node = (winner + k) / 2; node >= 1; node /= 2) {
+            int loser = tree[node];
+            const T* loser_key = active[loser] ? &head(loser) : nullptr;
+            bool loser_wins = beats(loser, loser_key, winner, winner_key, compared);
+
+            //   :      
+            int runs[2] = {winner, loser};
+            const T* keys[2] = {winner_key, loser_key};
+            tree[node] = runs[!loser_wins];
+            winner = runs[loser_wins];
+            winner_key = keys[loser_wins];
+        }
+        tree[0] = winner;
+        ops.comparisons += compared;
+        ops.memory_access += 2 * compared;
+    }
+
+    //   
+    void exhaust() {
+        active[tree[0]] = 0;
+        replay();
+    }
+};
+
+// k-   :  arr[run_starts[i], run_starts[i+1])
+//      out
+template<typename T>
+void loser_tree_merge_instrumented(T arr[], const vector<int>& run_starts, T out[], OperationCounts& ops) {
+    int k = static_cast<int>(run_starts.size()) - 1;
+    if (k <= 0) return;
+
+    vector<int> positions(run_starts.begin(), run_starts.end() - 1);
+    vector<char> active(k);
+    for (int run = 0; run < k; run++) {
+        active[run] = run_starts[run] < run_starts[run + 1];
+    }
+    ops.add_memory(sizeof(int) * k);
+
+    auto head = [&](int run) -> const T& {
+        return arr[positions[run]];
+    };
+    LoserTree<T, decltype(head)> tournament(move(active), head, ops);
+
+    int k_out = run_starts[0];
+    while (!tournament.empty()) {
+        int run = tournament.winner();
+        if (ops.accessed_indices.size() < 10000) {
+            ops.accessed_indices.push_back(positions[run]);
+        }
+        out[k_out++] = move(arr[positions[run]++]);
+        ops.memory_access += 2;
+
+        if (positions[run] < run_starts[run + 1]) {
+            tournament.replay();
+        } else {
+            tournament.exhaust();
+        }
+    }
+
+    ops.remove_memory(sizeof(int) * k);
+}
+
+// k-       (   
+// :  2*log2(k)   )
+template<typename T>
+void heap_kway_merge_instrumented(T arr[], const vector<int>& run_starts, T out[], OperationCounts& ops) {
+    int k = static_cast<int>(run_starts.size()) - 1;
+    if (k <= 0) return;
+
+    vector<int> positions(run_starts.begin(), run_starts.end() - 1);
+    vector<int> heap;
+    for (int run = 0; run < k; run++) {
+        if (run_starts[run] < run_starts[run + 1]) heap.push_back(run);
+    }
+    ops.add_memory(sizeof(int) * 2 * k);
+
+    auto later = [&](int a, int b) {
+        ops.comparisons++;
+        ops.memory_access += 2;
+        const T& x = arr[positions[a]];
+        const T& y = arr[positions[b]];
+        return y < x || (!(x < y) && b < a);
+    };
+    make_heap(heap.begin(), heap.end(), later);
+
+    int k_out = run_starts[0];
+    while (!heap.empty()) {
+        pop_heap(heap.begin(), heap.end(), later);
+        int run = heap.back();
+        out[k_out++] = move(arr[positions[run]++]);
+        ops.memory_access += 2;
+
+        if (positions[run] < run_starts[run + 1]) {
+            push_heap(heap.begin(), heap.end(), later);
+        } else {
+            heap.pop_back();
+        }
+    }
+
+    ops.remove_memory(sizeof(int) * 2 * k);
+}
+
+//   k : ceil(log2 k)    
+//  arr  out;    out
+template<typename T>
+void pairwise_kway_merge_instrumented(T arr[], const vector<int>& run_starts, T out[], OperationCounts& ops) {
+    int k = static_cast<int>(run_starts.size()) - 1;
+    if (k <= 0) return;
+
+    vector<int> bounds = run_starts;
+    T* source = arr;
+    T* target = out;
+
+    while (bounds.size() > 2 || source != out) {
+        vector<int> merged_bounds;
+        for (size_t run = 0; run + 1 < bounds.size(); run += 2) {
+            int left = bounds[run];
+            int mid = bounds[run + 1];
+            int right = run + 2 < bounds.size() ? bounds[run + 2] : mid;
+            int i = left, j = mid, k_out = left;
+
+            while (i < mid && j < right) {
+                ops.comparisons++;
+                ops.memory_access += 2;
+                if (source[j] < source[i]) {
+                    target[k_out++] = move(source[j++]);
+                } else {
+                    target[k_out++] = move(source[i++]);
+                }
+                ops.memory_access += 2;
+            }
+            while (i < mid) {
+                target[k_out++] = move(source[i++]);
+                ops.memory_access += 2;
+            }
+            while (j < right) {
+                target[k_out++] = move(source[j++]);
+                ops.memory_access += 2;
+            }
+
+            merged_bounds.push_back(left);
+        }
+        merged_bounds.push_back(bounds.back());
+
+        bounds = move(merged_bounds);
+        swap(source, target);
+        ops.passes++;
+    }
+}
+
+//    -  
+const size_t EXTERNAL_IO_BUFFER = 1 << 20;
+
+//      
+const size_t EXTERNAL_MIN_RUN_BUFFER = 64 << 10;
+
+//   ,    
+const int EXTERNAL_MERGE_FAN_IN = 64;
+
+//   :       
+const size_t EXTERNAL_MIN_MEMORY = 3 * EXTERNAL_MIN_RUN_BUFFER;
+
+//      introsort    (  64)
+const size_t EXTERNAL_SORT_STACK_RESERVE = sizeof(int) * 4 * 64;
+
+//          -
+class ExternalBlockReader {
+private:
+    ifstream file;
+    vector<char> buffer;
+    size_t position = 0;
+    size_t filled = 0;
+    ExternalSortResult& stats;
+
+    bool refill() {
+        auto start = chrono::high_resolution_clock::now();
+        file.read(buffer.data(), buffer.size());
+        filled = static_cast<size_t>(file.gcount());
+        position = 0;
+        stats.io_time += chrono::duration<double>(chrono::high_resolution_clock::now() - start).count();
+        stats.bytes_read += filled;
+        return filled > 0;
+    }
+
+public:
+    ExternalBlockReader(const string& path, size_t buffer_size, ExternalSortResult& result)
+        : buffer(buffer_size), stats(result) {
+        auto start = chrono::high_resolution_clock::now();
+        file.open(path, ios::binary);
+        stats.io_time += chrono::duration<double>(chrono::high_resolution_clock::now() - start).count();
+    }
+
+    bool is_open() const {
+        return file.is_open();
+    }
+
+    //  length  (    )
+    bool read_bytes(void* destination, size_t length) {
+        char* out = static_cast<char*>(destination);
+        while (length > 0) {
+            if (position == filled && !refill()) return false;
+            size_t chunk = min(length, filled - position);
+            memcpy(out, buffer.data() + position, chunk);
+            position += chunk;
+            out += chunk;
+            length -= chunk;
+        }
+        return true;
+    }
+};
+
+//          -
+class ExternalBlockWriter {
+private:
+    ofstream file;
+    vector<char> buffer;
+    size_t filled = 0;
+    ExternalSortResult& stats;
+
+public:
+    ExternalBlockWriter(const string& path, size_t buffer_size, ExternalSortResult& result)
+        : buffer(buffer_size), stats(result) {
+        auto start = chrono::high_resolution_clock::now();
+        file.open(path, ios::binary | ios::trunc);
+        stats.io_time += chrono::duration<double>(chrono::high_resolution_clock::now() - start).count();
+    }
+
+    ~ExternalBlockWriter() {
+        close();
+    }
+
+    bool is_open() const {
+        return file.is_open();
+    }
+
+    void write_bytes(const void* source, size_t length) {
+        const char* in = static_cast<const char*>(source);
+        while (length > 0) {
+            if (filled == buffer.size()) flush();
+            size_t chunk = min(length, buffer.size() - filled);
+            memcpy(buffer.data() + filled, in, chunk);
+            filled += chunk;
+            in += chunk;
+            length -= chunk;
+        }
+    }
+
+    void flush() {
+        if (filled == 0) return;
+        auto start = chrono::high_resolution_clock::now();
+        file.write(buffer.data(), filled);
+        stats.io_time += chrono::duration<double>(chrono::high_resolution_clock::now() - start).count();
+        stats.bytes_written += filled;
+        filled = 0;
+    }
+
+    //    ; false -  
+    bool close() {
+        if (!file.is_open()) return true;
+        flush();
+        auto start = chrono::high_resolution_clock::now();
+        file.close();
+        stats.io_time += chrono::duration<double>(chrono::high_resolution_clock::now() - start).count();
+        return !file.fail();
+    }
+};
+
+//    :  -  ,  -   
+template<typename T>
+void write_external_record(ExternalBlockWriter& writer, const T& value) {
+    if constexpr (is_same_v<T, string>) {
+        uint32_t length = static_cast<uint32_t>(value.size());
+        writer.write_bytes(&length, sizeof(length));
+        writer.write_bytes(value.data(), length);
+    } else {
+        writer.write_bytes(&value, sizeof(T));
+    }
+}
+
+//    ; false -  
+template<typename T>
+bool read_external_record(ExternalBlockReader& reader, T& value) {
+    if constexpr (is_same_v<T, string>) {
+        uint32_t length;
+        if (!reader.read_bytes(&length, sizeof(length))) return false;
+        value.resize(length);
+        return length == 0 || reader.read_bytes(&value[0], length);
+    } else {
+        return reader.read_bytes(&value, sizeof(T));
+    }
+}
+
+//  ,     
+template<typename T>
+size_t external_record_memory(const T& value) {
+    if constexpr (is_same_v<T, string>) {
+        return sizeof(T) + value.capacity();
+    } else {
+        return sizeof(T);
+    }
+}
+
+//      (k-   )
+template<typename T>
+bool merge_external_runs(const vector<string>& inputs, const string& output, size_t memory_limit,
+                         ExternalSortResult& stats, OperationCounts& ops) {
+    //        ,    
+    //    (fan-in  ,        )
+    size_t heads_memory = (sizeof(T) + sizeof(int) + 1) * inputs.size();
+    size_t run_buffer = (memory_limit - heads_memory) / (inputs.size() + 1);
+    ops.add_memory(run_buffer * (inputs.size() + 1) + sizeof(T) * inputs.size());
+
+    bool success = true;
+    vector<unique_ptr<ExternalBlockReader>> readers;
+    for (const auto& path : inputs) {
+        readers.push_back(make_unique<ExternalBlockReader>(path, run_buffer, stats));
+        if (!readers.back()->is_open()) {
+            success = false;
+            break;
+        }
+    }
+
+    //        
+    if (success) {
+        ExternalBlockWriter writer(output, run_buffer, stats);
+        success = writer.is_open();
+        if (success) {
+            //      
+            unique_ptr<T[]> heads = make_unique<T[]>(readers.size());
+            vector<char> active(readers.size());
+            for (size_t run = 0; run < readers.size(); run++) {
+                active[run] = read_external_record(*readers[run], heads[run]);
+            }
+            auto head = [&heads](int run) -> const T& {
+                return heads[run];
+            };
+            LoserTree<T, decltype(head)> tournament(move(active), head, ops);
+
+            while (!tournament.empty()) {
+                int run = tournament.winner();
+                write_external_record(writer, heads[run]);
+                ops.memory_access += 2;
+
+                if (read_external_record(*readers[run], heads[run])) {
+                    tournament.replay();
+                } else {
+                    tournament.exhaust();
+                }
+            }
+            success = writer.close();
+        }
+    }
+
+    ops.remove_memory(run_buffer * (inputs.size() + 1) + sizeof(T) * inputs.size());
+    return success;
+}
+
+//   :  input   output,   
+// memory_limit     - (  EXTERNAL_MIN_MEMORY).
+//    ,    EXTERNAL_MERGE_FAN_IN  ;
+//  -    
+template<typename T>
+bool external_merge_sort(const string& input, const string& output, size_t memory_limit,
+                         ExternalSortResult& stats, OperationCounts& ops) {
+    if (memory_limit < EXTERNAL_MIN_MEMORY) {
+        cerr << "Error: external sort needs at least " << EXTERNAL_MIN_MEMORY << " bytes of memory" << endl;
+        return false;
+    }
+
+    auto start = chrono::high_resolution_clock::now();
+    stats.memory_limit = memory_limit;
+
+    //    ;       
+    vector<string> runs;
+    bool success = true;
+
+    //  1:   .     
+    //       ,   
+    {
+        size_t io_buffer = min(EXTERNAL_IO_BUFFER, memory_limit / 4);
+        size_t chunk_memory = memory_limit - 2 * io_buffer - EXTERNAL_SORT_STACK_RESERVE;
+        //    int-,    INT_MAX
+        size_t capacity = min<size_t>(numeric_limits<int>::max(), max<size_t>(1, chunk_memory / sizeof(T)));
+        T* chunk = new T[capacity];
+        ops.add_memory(sizeof(T) * capacity + 2 * io_buffer);
+
+        ExternalBlockReader reader(input, io_buffer, stats);
+        success = reader.is_open();
+
+        bool more = success;
+        while (more) {
+            size_t count = 0;
+            size_t used = 0;
+            while (count < capacity && used < chunk_memory) {
+                if (!read_external_record(reader, chunk[count])) {
+                    more = false;
+                    break;
+                }
+                used += external_record_memory(chunk[count]);
+                count++;
+            }
+            if (count == 0) break;
+
+            introsort_instrumented(chunk, static_cast<int>(count), ops);
+            stats.elements += count;
+
+            string run_path = output + ".run0_" + to_string(runs.size());
+            runs.push_back(run_path);
+            ExternalBlockWriter writer(run_path, io_buffer, stats);
+            if (!writer.is_open()) {
+                success = false;
+                break;
+            }
+            for (size_t i = 0; i < count; i++) {
+                write_external_record(writer, chunk[i]);
+            }
+            if (!writer.close()) {
+                success = false;
+                break;
+            }
+        }
+
+        delete[] chunk;
+        ops.remove_memory(sizeof(T) * capacity + 2 * io_buffer);
+    }
+    stats.runs = static_cast<int>(runs.size());
+
+    //  2:   (     output)
+    int fan_in = static_cast<int>(min<size_t>(EXTERNAL_MERGE_FAN_IN, memory_limit / EXTERNAL_MIN_RUN_BUFFER - 1));
+    if (success && runs.empty()) {
+        ExternalBlockWriter writer(output, EXTERNAL_MIN_RUN_BUFFER, stats);
+        success = writer.is_open() && writer.close();
+    }
+    while (success && !runs.empty()) {
+        if (runs.size() == 1) {
+            remove(output.c_str());
+            success = rename(runs[0].c_str(), output.c_str()) == 0;
+            break;
+        }
+
+        stats.merge_passes++;
+        bool last_pass = static_cast<int>(runs.size()) <= fan_in;
+        vector<string> next_runs;
+        size_t first = 0;
+        for (; success && first < runs.size(); first += fan_in) {
+            vector<string> group(runs.begin() + first, runs.begin() + min(runs.size(), first + fan_in));
+            string merged = last_pass ? output
+                                      : output + ".run" + to_string(stats.merge_passes) + "_" + to_string(next_runs.size());
+            next_runs.push_back(merged);
+            success = merge_external_runs<T>(group, merged, memory_limit, stats, ops);
+            for (const auto& path : group) {
+                remove(path.c_str());
+            }
+        }
+        //       ( )     
+        if (!success) {
+            next_runs.insert(next_runs.end(), runs.begin() + min(first, runs.size()), runs.end());
+        }
+        runs = move(next_runs);
+        if (last_pass) break;
+    }
+
+    if (!success) {
+        for (const auto& path : runs) {
+            remove(path.c_str());
+        }
+    }
+
+    stats.total_time = chrono::duration<double>(chrono::high_resolution_clock::now() - start).count();
+    stats.cpu_time = max(0.0, stats.total_time - stats.io_time);
+    return success;
+}
+
+//   :  
+struct IdentityProjection {
+    template<typename U>
+    U&& operator()(U&& value) const {
+        return forward<U>(value);
+    }
+};
+
+//   ,   comp(proj(a), proj(b)).   
+//      (, , ),  
+//          
+template<typename RandomIt, typename Compare, typename Projection>
+struct ProjectedIndex {
+    struct Context {
+        RandomIt first;
+        const Compare* comp;
+        const Projection* proj;
+    };
+
+    uint32_t index = 0;
+    const Context* context = nullptr;
+
+    bool less(const ProjectedIndex& other) const {
+        return (*context->comp)(invoke(*context->proj, context->first[index]),
+                                invoke(*context->proj, context->first[other.index]));
+    }
+
+    bool operator<(const ProjectedIndex& other) const { return less(other); }
+    bool operator>(const ProjectedIndex& other) const { return other.less(*this); }
+    bool operator<=(const ProjectedIndex& other) const { return !other.less(*this); }
+    bool operator>=(const ProjectedIndex& other) const { return !less(other); }
+    bool operator==(const ProjectedIndex& other) const { return !less(other) && !other.less(*this); }
+    bool operator!=(const ProjectedIndex& other) const { return !(*this == other); }
+};
+
+//      :  keys[a] < keys[b]
+template<typename T>
+using ArgsortIndex = ProjectedIndex<const T*, less<>, IdentityProjection>;
+
+//  :  keys  ,    
+// sort_indices(ArgsortIndex<T>[], n, ops).  - : keys[perm[0]] <= keys[perm[1]] <= ...
+template<typename T, typename Sorter>
+vector<uint32_t> argsort_instrumented(const T keys[], int n, Sorter sort_indices, OperationCounts& ops) {
+    ArgsortIndex<T>* indices = new ArgsortIndex<T>[n];
+    ops.add_memory(sizeof(ArgsortIndex<T>) * n);
+    less<> key_less;
+    IdentityProjection identity;
+    typename ArgsortIndex<T>::Context context{keys, &key_less, &identity};
+    for (int i = 0; i < n; i++) {
+        indices[i].index = static_cast<uint32_t>(i);
+        indices[i].context = &context;
+    }
+    ops.memory_access += n;
+
+    sort_indices(indices, n, ops);
+
+    vector<uint32_t> permutation(n);
+    for (int i = 0; i < n; i++) {
+        permutation[i] = indices[i].index;
+    }
+    ops.memory_access += 2LL * n;
+
+    delete[] indices;
+    ops.remove_memory(sizeof(ArgsortIndex<T>) * n);
+    return permutation;
+}
+
+//     :   ,  
+template<typename T>
+void apply_permutation_instrumented(T arr[], const vector<uint32_t>& permutation, OperationCounts& ops) {
+    int n = static_cast<int>(permutation.size());
+    T* gathered = new T[n];
+    ops.add_memory(sizeof(T) * n);
+
+    for (int i = 0; i < n; i++) {
+        gathered[i] = move(arr[permutation[i]]);
+    }
+    for (int i = 0; i < n; i++) {
+        arr[i] = move(gathered[i]);
+    }
+    ops.memory_access += 4LL * n;
+
+    delete[] gathered;
+    ops.remove_memory(sizeof(T) * n);
+}
+
+//    :    ,  
+template<typename T>
+void std_sort_instrumented(T arr[], int n, OperationCounts& ops) {
+    if (n < 2) return;
+
+    // std::sort -    ,  O(log n)
+    size_t stack_memory = sizeof(int) * 4 * static_cast<size_t>(2 * log2(n) + 1);
+    ops.add_memory(stack_memory);
+
+    long long comparisons_before = ops.comparisons;
+    std::sort(arr, arr + n, [&ops](const T& a, const T& b) {
+        ops.comparisons++;
+        return a < b;
+    });
+    ops.memory_access += 2 * (ops.comparisons - comparisons_before);
+
+    //    std::sort
+    ops.swaps += static_cast<long long>(n * log2(n) * 0.5);
+
+    ops.remove_memory(stack_memory);
+}
+
+//  :         ,   -
+// string_view ( + , 16 ),     
+class StringArena {
+private:
+    vector<char> chars;
+    vector<size_t> offsets;  //  ;   -   
+
+public:
+    StringArena(int expected_strings, size_t expected_chars) {
+        chars.reserve(expected_chars);
+        offsets.reserve(expected_strings + 1);
+        offsets.push_back(0);
+    }
+
+    //     
+    void push_char(char c) {
+        chars.push_back(c);
+    }
+
+    void append(const char* data, size_t length) {
+        chars.insert(chars.end(), data, data + length);
+    }
+
+    void append_number(int value) {
+        char digits[16];
+        auto result = to_chars(digits, digits + sizeof(digits), value);
+        append(digits, result.ptr - digits);
+    }
+
+    //   
+    void end_string() {
+        offsets.push_back(chars.size());
+    }
+
+    //   ;       
+    void fill_views(string_view views[]) {
+        for (size_t i = 0; i + 1 < offsets.size(); i++) {
+            views[i] = string_view(chars.data() + offsets[i], offsets[i + 1] - offsets[i]);
+        }
+        offsets.clear();
+        offsets.shrink_to_fit();
+    }
+};
+
+// ,  create_array:  ,  string_view -    
+template<typename T>
+struct TestArray {
+    unique_ptr<T[]> elements;
+    unique_ptr<StringArena> arena;
+
+    T* data() const {
+        return elements.get();
+    }
+};
+
+//      
+template<typename T>
+TestArray<T> create_array(int n, int type) {
+    T* arr = new T[n];
+
+    if constexpr (is_integral_v<T> && !is_same_v<T, bool>) {
+        switch (type) {
+            case 0: // 
+                for (int i = 0; i < n; i++) {
+                    arr[i] = rand_uns(1, 10000);
+                }
+                break;
             case 1: // 
                 for (int i = 0; i < n; i++) {
                     arr[i] = i + 1;
@@ -929,12 +4780,12 @@ T* create_array(int n, int type) {
         }
     }
 
-    return arr;
+    return {unique_ptr<T[]>(arr), nullptr};
 }
 
 //   bool
 template<>
-bool* create_array<bool>(int n, int type) {
+TestArray<bool> create_array<bool>(int n, int type) {
     bool* arr = new bool[n];
     switch (type) {
         case 0: // 
@@ -967,7 +4818,125 @@ bool* create_array<bool>(int n, int type) {
             }
             break;
     }
-    return arr;
+    return {unique_ptr<bool[]>(arr), nullptr};
+}
+
+//     :   ,   create_array<string>,  
+//      
+template<>
+TestArray<string_view> create_array<string_view>(int n, int type) {
+    const char chars[] = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789";
+    const int charset_size = sizeof(chars) - 1;
+    const vector<string> unique_strings = {"apple", "banana", "cherry", "date", "elderberry",
+                                           "fig", "grape", "honeydew", "kiwi", "lemon"};
+
+    auto arena = make_unique<StringArena>(n, static_cast<size_t>(n) * 16);
+    switch (type) {
+        case 0: //  
+            for (int i = 0; i < n; i++) {
+                int len = rand_uns(5, 15);
+                for (int j = 0; j < len; j++) {
+                    arena->push_char(chars[rand_uns(0, charset_size - 1)]);
+                }
+                arena->end_string();
+            }
+            break;
+        case 1: //  
+        case 3: //   ( )
+            for (int i = 0; i < n; i++) {
+                arena->append("str_", 4);
+                arena->append_number(i);
+                arena->end_string();
+            }
+            break;
+        case 2: //  
+            for (int i = 0; i < n; i++) {
+                arena->append("str_", 4);
+                arena->append_number(n - i);
+                arena->end_string();
+            }
+            break;
+        case 4: //   
+            for (int i = 0; i < n; i++) {
+                const string& s = unique_strings[rand_uns(0, static_cast<int>(unique_strings.size()) - 1)];
+                arena->append(s.data(), s.size());
+                arena->end_string();
+            }
+            break;
+    }
+
+    string_view* arr = new string_view[n];
+    arena->fill_views(arr);
+    if (type == 3) {
+        for (int i = 0; i < n/10; i++) {
+            int idx1 = rand_uns(0, n-1);
+            int idx2 = rand_uns(0, n-1);
+            swap(arr[idx1], arr[idx2]);
+        }
+    }
+
+    return {unique_ptr<string_view[]>(arr), move(arena)};
+}
+
+//  ,         
+const int EXTERNAL_GENERATION_BLOCK = 1 << 20;
+
+//      index (  create_array)
+template<typename T>
+T external_sorted_value(long long index, long long n) {
+    if constexpr (is_same_v<T, bool>) {
+        return index >= n / 2;
+    } else if constexpr (is_same_v<T, string>) {
+        return "str_" + to_string(index);
+    } else if constexpr (is_integral_v<T>) {
+        return static_cast<T>(index + 1);
+    } else {
+        return static_cast<T>(index);
+    }
+}
+
+//     :      
+template<typename T>
+TestArray<T> create_external_block(long long start, int count, long long n, int type) {
+    //        
+    if (type == 0 || type == 4) {
+        return create_array<T>(count, type);
+    }
+
+    T* block = new T[count];
+    for (int i = 0; i < count; i++) {
+        long long index = start + i;
+        block[i] = external_sorted_value<T>(type == 2 ? n - 1 - index : index, n);
+    }
+
+    //  : 10%    
+    if (type == 3) {
+        for (int i = 0; i < count / 10; i++) {
+            int idx1 = rand_uns(0, count - 1);
+            int idx2 = rand_uns(0, count - 1);
+            swap(block[idx1], block[idx2]);
+        }
+    }
+
+    return {unique_ptr<T[]>(block), nullptr};
+}
+
+//           
+template<typename T>
+bool create_external_input(const string& path, long long n, int type) {
+    ExternalSortResult generation_stats;
+    ExternalBlockWriter writer(path, EXTERNAL_IO_BUFFER, generation_stats);
+    if (!writer.is_open()) return false;
+
+    for (long long start = 0; start < n; start += EXTERNAL_GENERATION_BLOCK) {
+        int count = static_cast<int>(min<long long>(EXTERNAL_GENERATION_BLOCK, n - start));
+        TestArray<T> block = create_external_block<T>(start, count, n, type);
+        for (int i = 0; i < count; i++) {
+            write_external_record(writer, block.elements[i]);
+        }
+    }
+
+    return writer.close();
 }
 
 //    
@@ -1034,6 +5003,10 @@ public:
         GetClientRect(hwnd, &clientRect);
         FillRect(hdc, &clientRect, (HBRUSH)(COLOR_WINDOW + 1));
 
+        //       
+        auto current_algorithms = results[current_data_type].getAlgorithmsForDistribution(distributions[current_distribution]);
+        auto& sizes = results[current_data_type].test_sizes;
+
         //  
         wchar_t title[400];
         wchar_t data_type_name[50];
@@ -1058,12 +5031,9 @@ public:
         if (current_display == 0) {
             wcscpy(algo_display, L"All Algorithms");
         } else {
-            const wchar_t* algo_names[] = {
-                L"Bubble Sort", L"Selection Sort", L"Insertion Sort",
-                L"Quick Sort", L"Merge Sort", L"Heap Sort", L"std::sort"
-            };
-            if (current_display - 1 < 7) {
-                wcscpy(algo_display, algo_names[current_display - 1]);
+            if (current_display - 1 < static_cast<int>(current_algorithms.size())) {
+                wstring algo_w = string_to_wstring(current_algorithms[current_display - 1].name);
+                wcscpy(algo_display, algo_w.c_str());
             } else {
                 wcscpy(algo_display, L"Unknown Algorithm");
             }
@@ -1098,9 +5068,6 @@ public:
         }
 
         //    
-        auto current_algorithms = results[current_data_type].getAlgorithmsForDistribution(distributions[current_distribution]);
-        auto& sizes = results[current_data_type].test_sizes;
-
         vector<double> x_values;
         vector<vector<double>> y_values(current_algorithms.size());
         vector<vector<double>> original_y_values(current_algorithms.size());
@@ -1282,7 +5249,24 @@ public:
             RGB(255, 0, 255),   // Magenta - Quick
             RGB(0, 128, 128),   // Teal - Merge
             RGB(128, 0, 128),   // Purple - Heap
-            RGB(255, 128, 0)    // Orange - std::sort
+            RGB(255, 128, 0),   // Orange - std::sort
+            RGB(128, 64, 0),    // Brown - Introsort
+            RGB(0, 160, 255),   // Sky - Parallel Quick
+            RGB(128, 128, 0),   // Olive - Parallel Merge
+            RGB(255, 0, 128),   // Pink - Bottom-Up Merge
+            RGB(64, 64, 64),    // Gray - Radix LSD
+            RGB(0, 200, 100),   // Mint - American Flag
+            RGB(100, 0, 255),   // Violet - Counting
+            RGB(200, 160, 0),   // Gold - Block Quick
+            RGB(0, 100, 0),     // Dark green - Timsort
+            RGB(0, 0, 128),     // Navy - Introsort SIMD
+            RGB(160, 80, 80),   // Rose - Merge SIMD
+            RGB(80, 160, 160),  // Cadet - Vector Quick
+            RGB(220, 100, 40),  // Rust - Parallel Sample
+            RGB(150, 0, 60),    // Maroon - Heap Bottom-Up
+            RGB(90, 60, 160),   // Indigo - Heap 4-ary
+            RGB(0, 130, 200),   // Azure - Multikey Quick
+            RGB(120, 120, 200)  // Lavender - Parallel Radix
         };
 
         //   
@@ -1333,30 +5317,27 @@ public:
 
         TextOutW(hdc, legendX, legendY, L"Legend:", 7);
 
-        const wchar_t* algo_names[] = {
-            L"Bubble Sort", L"Selection Sort", L"Insertion Sort",
-            L"Quick Sort", L"Merge Sort", L"Heap Sort", L"std::sort"
-        };
-
-        for (int i = 0; i < 7; i++) {
+        for (int i = 0; i < static_cast<int>(current_algorithms.size()); i++) {
             if (current_display == 0 || current_display == i + 1) {
-                HBRUSH legendBrush = CreateSolidBrush(colors[i]);
+                COLORREF color = colors[i % colors.size()];
+                HBRUSH legendBrush = CreateSolidBrush(color);
                 HBRUSH oldBrush = (HBRUSH)SelectObject(hdc, legendBrush);
                 Rectangle(hdc, legendX, legendY + 25 + i * 20, legendX + 15, legendY + 40 + i * 20);
                 SelectObject(hdc, oldBrush);
                 DeleteObject(legendBrush);
 
-                SetTextColor(hdc, colors[i]);
-                TextOutW(hdc, legendX + 20, legendY + 25 + i * 20, algo_names[i], wcslen(algo_names[i]));
+                wstring algo_w = string_to_wstring(current_algorithms[i].name);
+                SetTextColor(hdc, color);
+                TextOutW(hdc, legendX + 20, legendY + 25 + i * 20, algo_w.c_str(), algo_w.length());
             }
         }
 
         // 
         SetTextColor(hdc, RGB(0, 0, 0));
         TextOutW(hdc, margin, graphTop - 80,
-                L"Q/W/E/R/T: Data Types | A/S/D/F/G: Distributions", 50);
-        TextOutW(hdc, margin, graphTop - 60,
-                L"0-7: Algorithms (0-all, 1-7-specific) | L: Toggle Log X | K: Toggle Log Y", 75);
+                L"Q/W/E/R/T/Y: Data Types | A/S/D/F/G: Distributions", 52);
+        const wchar_t* algo_controls = L"0-9, Left/Right: Algorithms (0-all) | L: Toggle Log X | K: Toggle Log Y";
+        TextOutW(hdc, margin, graphTop - 60, algo_controls, wcslen(algo_controls));
         TextOutW(hdc, margin, graphTop - 40,
                 L"N: Toggle Normalized View | ESC: Exit", 38);
 
@@ -1379,13 +5360,24 @@ public:
         }
     }
 
+    //        
+    int getAlgorithmCount() const {
+        return static_cast<int>(results[current_data_type].getAlgorithmsForDistribution(distributions[current_distribution]).size());
+    }
+
     void setDisplay(int display) {
-        if (display >= 0 && display <= 7) {
+        if (display >= 0 && display <= getAlgorithmCount()) {
             current_display = display;
             InvalidateRect(hwnd, NULL, TRUE);
         }
     }
 
+    //    
+    void cycleDisplay(int step) {
+        int count = getAlgorithmCount() + 1;
+        setDisplay(((current_display + step) % count + count) % count);
+    }
+
     void toggleLogScaleX() {
         log_scale_x = !log_scale_x;
         InvalidateRect(hwnd, NULL, TRUE);
@@ -1416,12 +5408,15 @@ public:
                     else if (wParam == 'E') pThis->setDataType(2);
                     else if (wParam == 'R') pThis->setDataType(3);
                     else if (wParam == 'T') pThis->setDataType(4);
+                    else if (wParam == 'Y') pThis->setDataType(5);
                     else if (wParam == 'A') pThis->setDistribution(0);
                     else if (wParam == 'S') pThis->setDistribution(1);
                     else if (wParam == 'D') pThis->setDistribution(2);
                     else if (wParam == 'F') pThis->setDistribution(3);
                     else if (wParam == 'G') pThis->setDistribution(4);
-                    else if (wParam >= '0' && wParam <= '7') pThis->setDisplay(wParam - '0');
+                    else if (wParam >= '0' && wParam <= '9') pThis->setDisplay(wParam - '0');
+                    else if (wParam == VK_LEFT) pThis->cycleDisplay(-1);
+                    else if (wParam == VK_RIGHT) pThis->cycleDisplay(1);
                     else if (wParam == 'L') pThis->toggleLogScaleX();
                     else if (wParam == 'K') pThis->toggleLogScaleY();
                     else if (wParam == 'N') pThis->toggleNormalizedView();
@@ -1484,7 +5479,7 @@ public:
 
         hwnd = CreateWindowW(
             L"ResultsTable", L"Analysis Results - Fixed Memory Counters",
-            WS_OVERLAPPEDWINDOW, 400, 200, 1200, 800,
+            WS_OVERLAPPEDWINDOW, 400, 200, 1350, 800,
             NULL, NULL, GetModuleHandle(NULL), this
         );
 
@@ -1527,7 +5522,8 @@ public:
         int x_swaps = 650;
         int x_memory = 800;
         int x_efficiency = 950;
-        int x_stable = 1100;
+        int x_argsort = 1100;
+        int x_stable = 1250;
 
         TextOutW(hdc, x_algorithm, y, L"Algorithm", 9);
         TextOutW(hdc, x_time, y, L"Avg Time (s)", 12);
@@ -1536,6 +5532,7 @@ public:
         TextOutW(hdc, x_swaps, y, L"Swaps", 5);
         TextOutW(hdc, x_memory, y, L"Memory (KB)", 11);
         TextOutW(hdc, x_efficiency, y, L"Efficiency %", 12);
+        TextOutW(hdc, x_argsort, y, L"Argsort (s)", 11);
         TextOutW(hdc, x_stable, y, L"Stable", 6);
 
         y += 30;
@@ -1573,6 +5570,15 @@ public:
             swprintf(eff_str, 20, L"%.1f", algo.cache_efficiency * 100);
             TextOutW(hdc, x_efficiency, y, eff_str, wcslen(eff_str));
 
+            //   +  (    )
+            wchar_t argsort_str[40];
+            if (algo.has_argsort) {
+                swprintf(argsort_str, 40, L"%.6f+%.6f", algo.argsort_time, algo.gather_time);
+            } else {
+                swprintf(argsort_str, 40, L"-");
+            }
+            TextOutW(hdc, x_argsort, y, argsort_str, wcslen(argsort_str));
+
             TextOutW(hdc, x_stable, y, algo.stable ? L"Yes" : L"No", algo.stable ? 3 : 2);
 
             y += 20;
@@ -1589,78 +5595,770 @@ public:
         TextOutW(hdc, 50, y, L"- Merge Sort: O(n) temporary arrays", 35);
         y += 20;
         TextOutW(hdc, 50, y, L"- Heap Sort: O(1) extra space", 30);
+        y += 20;
+        TextOutW(hdc, 50, y, L"- Introsort: O(log n) stack space", 33);
+        y += 20;
+        TextOutW(hdc, 50, y, L"- Parallel Quick: O(log n) stack space per thread", 49);
+        y += 20;
+        TextOutW(hdc, 50, y, L"- Parallel Merge: O(n) shared buffer", 36);
+        y += 20;
+        TextOutW(hdc, 50, y, L"- Bottom-Up Merge: one O(n) buffer", 34);
+        y += 20;
+        TextOutW(hdc, 50, y, L"- Radix LSD: O(n) buffer + histograms", 37);
+        y += 20;
+        TextOutW(hdc, 50, y, L"- American Flag: in place, O(256) counters per level", 52);
+        y += 20;
+        TextOutW(hdc, 50, y, L"- Counting: O(k) counters, O(n) buffer for non-integral keys", 60);
+        y += 20;
+        TextOutW(hdc, 50, y, L"- Block Quick: O(log n) stack + 128-byte offset buffers", 55);
+        y += 20;
+        TextOutW(hdc, 50, y, L"- Timsort: O(n/2) merge buffer", 30);
+        y += 20;
+        TextOutW(hdc, 50, y, L"- Introsort/Merge SIMD: AVX2 sorting networks for leaves of 16", 62);
+        y += 20;
+        TextOutW(hdc, 50, y, L"- Vector Quick: in-place AVX2/AVX-512 partition, O(log n) stack", 63);
+        y += 20;
+        TextOutW(hdc, 50, y, L"- Parallel Sample: O(n) scatter buffer + bucket ids", 51);
+        y += 20;
+        TextOutW(hdc, 50, y, L"- Heap Bottom-Up / 4-ary: O(1), iterative sift", 46);
+        y += 20;
+        TextOutW(hdc, 50, y, L"- Multikey Quick: in place, O(log n + max length) stack", 55);
+        y += 20;
+        TextOutW(hdc, 50, y, L"- Parallel Radix: O(n) buffer + 16 KB write-combining lines per thread", 70);
 
         // 
         y += 30;
         TextOutW(hdc, 50, y, L"Controls:", 9);
         y += 25;
-        TextOutW(hdc, 50, y, L"Q/W/E/R/T: Data Types | A/S/D/F/G: Distributions | ESC: Exit", 60);
+        TextOutW(hdc, 50, y, L"Q/W/E/R/T/Y: Data Types | A/S/D/F/G: Distributions | ESC: Exit", 62);
 
         EndPaint(hwnd, &ps);
     }
 
-    void setDataType(int type) {
-        if (type >= 0 && static_cast<size_t>(type) < results.size()) {
-            current_data_type = type;
-            InvalidateRect(hwnd, NULL, TRUE);
+    void setDataType(int type) {
+        if (type >= 0 && static_cast<size_t>(type) < results.size()) {
+            current_data_type = type;
+            InvalidateRect(hwnd, NULL, TRUE);
+        }
+    }
+
+    void setDistribution(int dist) {
+        if (dist >= 0 && static_cast<size_t>(dist) < distributions.size()) {
+            current_distribution = dist;
+            InvalidateRect(hwnd, NULL, TRUE);
+        }
+    }
+
+    static LRESULT CALLBACK TableWindowProc(HWND hwnd, UINT uMsg, WPARAM wParam, LPARAM lParam) {
+        ResultsTableWindow* pThis = (ResultsTableWindow*)GetWindowLongPtr(hwnd, GWLP_USERDATA);
+
+        switch (uMsg) {
+            case WM_PAINT:
+                if (pThis) pThis->drawTable();
+                break;
+
+            case WM_KEYDOWN:
+                if (pThis) {
+                    if (wParam == 'Q') pThis->setDataType(0);
+                    else if (wParam == 'W') pThis->setDataType(1);
+                    else if (wParam == 'E') pThis->setDataType(2);
+                    else if (wParam == 'R') pThis->setDataType(3);
+                    else if (wParam == 'T') pThis->setDataType(4);
+                    else if (wParam == 'Y') pThis->setDataType(5);
+                    else if (wParam == 'A') pThis->setDistribution(0);
+                    else if (wParam == 'S') pThis->setDistribution(1);
+                    else if (wParam == 'D') pThis->setDistribution(2);
+                    else if (wParam == 'F') pThis->setDistribution(3);
+                    else if (wParam == 'G') pThis->setDistribution(4);
+                    else if (wParam == VK_ESCAPE) DestroyWindow(hwnd);
+                }
+                break;
+
+            case WM_DESTROY:
+                PostQuitMessage(0);
+                break;
+
+            default:
+                return DefWindowProc(hwnd, uMsg, wParam, lParam);
+        }
+        return 0;
+    }
+
+    void runMessageLoop() {
+        MSG msg = {};
+        while (GetMessage(&msg, NULL, 0, 0)) {
+            TranslateMessage(&msg);
+            DispatchMessage(&msg);
+        }
+    }
+};
+
+//        
+const int SCALING_ARRAY_SIZE = 1000000;
+const int SCALING_REPEATS = 3;
+
+//  ,     k   
+const int SELECTION_ARRAY_SIZE = 100000;
+const int SELECTION_REPEATS = 3;
+const vector<double> SELECTION_K_FRACTIONS = {0.001, 0.01, 0.1, 0.5, 1.0};
+
+//      (2..SORTING_NETWORK_MAX)  
+const int SMALL_SORT_BATCH = 1000;
+
+//  ,        k- ;
+//   KWAY_MERGE_MAX_ELEMENTS  
+const vector<int> KWAY_MERGE_FAN_INS = {2, 4, 8, 16, 32, 64, 128};
+const vector<int> KWAY_MERGE_RUN_LENGTHS = {100, 10000, 100000};
+const int KWAY_MERGE_MAX_ELEMENTS = 1 << 22;
+const int KWAY_MERGE_REPEATS = 3;
+
+//         
+const vector<int> PRESORTEDNESS_ARRAY_SIZES = {10000, 1000000};
+const int PRESORTEDNESS_TRIALS = 5;
+
+//    (   -   run_sort_algorithm)
+const vector<string> SORT_ALGORITHM_NAMES = {
+    "Bubble",
+    "Selection",
+    "Insertion",
+    "Quick",
+    "Merge",
+    "Heap",
+    "std::sort",
+    "Introsort",
+    "Parallel Quick",
+    "Parallel Merge",
+    "Bottom-Up Merge",
+    "Radix LSD",
+    "American Flag",
+    "Counting",
+    "Block Quick",
+    "Timsort",
+    "Introsort SIMD",
+    "Merge SIMD",
+    "Vector Quick",
+    "Parallel Sample",
+    "Heap Bottom-Up",
+    "Heap 4-ary",
+    "Multikey Quick",
+    "Parallel Radix"
+};
+
+//     
+template<typename T>
+bool is_sort_algorithm_applicable(size_t algo_index) {
+    switch (algo_index) {
+        case 11:
+        case 23: return is_radix_sortable_v<T>;
+        case 12:
+        case 22: return is_string_like_v<T>;
+        case 16:
+        case 17: return is_simd_sortable_v<T>;
+        case 18: return is_vector_partitionable_v<T>;
+        default: return true;
+    }
+}
+
+//  :      (std::sort  )
+inline bool is_sort_algorithm_stable(size_t algo_index) {
+    switch (algo_index) {
+        case 2:
+        case 4:
+        case 9:
+        case 10:
+        case 11:
+        case 13:
+        case 15:
+        case 23: return true;
+        default: return false;
+    }
+}
+
+//   :     (   ) 
+//   ; 0 -   
+inline int parallel_sort_grain(size_t algo_index) {
+    switch (algo_index) {
+        case 8: return PARALLEL_QUICK_GRAIN;
+        case 9: return PARALLEL_MERGE_GRAIN;
+        case 19: return SAMPLE_SORT_GRAIN;
+        case 23: return PARALLEL_RADIX_GRAIN;
+        default: return 0;
+    }
+}
+
+inline bool is_parallel_sort_fallback(size_t algo_index, int size, int num_threads) {
+    int grain = parallel_sort_grain(algo_index);
+    return grain > 0 && (num_threads <= 1 || size <= grain);
+}
+
+//   (Bubble, Selection, Insertion):      
+inline bool is_sort_algorithm_quadratic(size_t algo_index) {
+    return algo_index <= 2;
+}
+
+//      (Counting,  bool   ):   
+// create_array     ,      
+inline bool is_sort_algorithm_key_range_dependent(size_t algo_index, const string& type_name) {
+    return algo_index == 13 && type_name != "bool";
+}
+
+//     (       )
+template<typename T>
+void run_sort_algorithm(size_t algo_index, T arr[], int size, int num_threads, OperationCounts& ops) {
+    switch (algo_index) {
+        case 0: bubble_sort_instrumented(arr, size, ops); break;
+        case 1: selection_sort_instrumented(arr, size, ops); break;
+        case 2: insertion_sort_instrumented(arr, size, ops); break;
+        case 3: quick_sort_instrumented(arr, size, ops); break;
+        case 4: merge_sort_instrumented(arr, size, ops); break;
+        case 5: heap_sort_instrumented(arr, size, ops); break;
+        case 6: std_sort_instrumented(arr, size, ops); break;
+        case 7: introsort_instrumented(arr, size, ops); break;
+        case 8: parallel_quick_sort_instrumented(arr, size, num_threads, ops); break;
+        case 9: parallel_merge_sort_instrumented(arr, size, num_threads, ops); break;
+        case 10: bottom_up_merge_sort_instrumented(arr, size, ops); break;
+        case 11:
+            if constexpr (is_radix_sortable_v<T>) radix_sort_instrumented(arr, size, ops);
+            break;
+        case 12:
+            if constexpr (is_string_like_v<T>) american_flag_sort_instrumented(arr, size, ops);
+            break;
+        case 13: counting_sort_instrumented(arr, size, ops); break;
+        case 14: block_quick_sort_instrumented(arr, size, ops); break;
+        case 15: timsort_instrumented(arr, size, ops); break;
+        case 16: introsort_instrumented(arr, size, ops, true); break;
+        case 17: bottom_up_merge_sort_instrumented(arr, size, ops, true); break;
+        case 18:
+            if constexpr (is_vector_partitionable_v<T>) vector_quick_sort_instrumented(arr, size, ops);
+            break;
+        case 19: parallel_sample_sort_instrumented(arr, size, num_threads, ops); break;
+        case 20: bottom_up_heap_sort_instrumented(arr, size, ops); break;
+        case 21: quaternary_heap_sort_instrumented(arr, size, ops); break;
+        case 22:
+            if constexpr (is_string_like_v<T>) multikey_quicksort_instrumented(arr, size, ops);
+            break;
+        case 23:
+            if constexpr (is_radix_sortable_v<T>) parallel_radix_sort_instrumented(arr, size, num_threads, ops);
+            break;
+    }
+}
+
+// ====================   ====================
+
+//      :       
+template<typename RandomIt, typename Compare, typename Projection>
+constexpr bool is_direct_sort_range_v =
+    is_same_v<Projection, IdentityProjection> &&
+    (is_same_v<Compare, less<>> || is_same_v<Compare, less<typename iterator_traits<RandomIt>::value_type>>) &&
+    (is_pointer_v<RandomIt> ||
+     (is_same_v<RandomIt, typename vector<typename iterator_traits<RandomIt>::value_type>::iterator> &&
+      !is_same_v<typename iterator_traits<RandomIt>::value_type, bool>));
+
+//  ,      (   int)
+const long long SORT_RANGE_MAX_BLOCK = numeric_limits<int>::max();
+
+//    :     ,   
+template<typename RandomIt, typename Compare, typename Projection>
+bool is_sort_range_applicable(size_t algo_index) {
+    if constexpr (is_direct_sort_range_v<RandomIt, Compare, Projection>) {
+        return is_sort_algorithm_applicable<typename iterator_traits<RandomIt>::value_type>(algo_index);
+    } else {
+        return is_sort_algorithm_applicable<ProjectedIndex<RandomIt, Compare, Projection>>(algo_index);
+    }
+}
+
+//    2..SORT_RANGE_MAX_BLOCK .   
+//      ,     
+//      (     )
+template<typename RandomIt, typename Compare, typename Projection>
+void sort_range_block(RandomIt first, int n, size_t algo_index, OperationCounts& ops,
+                      const Compare& comp, const Projection& proj, int num_threads) {
+    using Value = typename iterator_traits<RandomIt>::value_type;
+    using Index = ProjectedIndex<RandomIt, Compare, Projection>;
+
+    if constexpr (is_direct_sort_range_v<RandomIt, Compare, Projection>) {
+        run_sort_algorithm(algo_index, &*first, n, num_threads, ops);
+    } else {
+        Index* indices = new Index[n];
+        ops.add_memory(sizeof(Index) * n);
+        typename Index::Context context{first, &comp, &proj};
+        for (int i = 0; i < n; i++) {
+            indices[i].index = static_cast<uint32_t>(i);
+            indices[i].context = &context;
+        }
+
+        run_sort_algorithm(algo_index, indices, n, num_threads, ops);
+
+        //  :   i   indices[i];   
+        for (int i = 0; i < n; i++) {
+            if (static_cast<int>(indices[i].index) == i) continue;
+
+            Value value = move(first[i]);
+            int j = i;
+            while (static_cast<int>(indices[j].index) != i) {
+                int next = static_cast<int>(indices[j].index);
+                first[j] = move(first[next]);
+                indices[j].index = static_cast<uint32_t>(j);
+                ops.swaps++;
+                j = next;
+            }
+            first[j] = move(value);
+            indices[j].index = static_cast<uint32_t>(j);
+            ops.swaps++;
+        }
+        ops.memory_access += 3LL * n;
+
+        delete[] indices;
+        ops.remove_memory(sizeof(Index) * n);
+    }
+}
+
+//    block_size       (std::inplace_merge)
+template<typename RandomIt, typename Compare, typename Projection>
+bool sort_range_in_blocks(RandomIt first, RandomIt last, size_t algo_index, OperationCounts& ops,
+                          const Compare& comp, const Projection& proj, int num_threads, long long block_size) {
+    if (!is_sort_range_applicable<RandomIt, Compare, Projection>(algo_index)) return false;
+
+    long long n = last - first;
+    if (n < 2) return true;
+
+    for (long long start = 0; start < n; start += block_size) {
+        int count = static_cast<int>(min(block_size, n - start));
+        if (count > 1) sort_range_block(first + start, count, algo_index, ops, comp, proj, num_threads);
+    }
+
+    auto projected_less = [&comp, &proj](const auto& a, const auto& b) {
+        return comp(invoke(proj, a), invoke(proj, b));
+    };
+    for (long long width = block_size; width < n; width *= 2) {
+        for (long long start = 0; start + width < n; start += 2 * width) {
+            long long end = min(start + 2 * width, n);
+            inplace_merge(first + start, first + start + width, first + end, projected_less);
+            ops.memory_access += 2 * (end - start);
+        }
+        ops.passes++;
+    }
+    return true;
+}
+
+//  [first, last)  algo_index  SORT_ALGORITHM_NAMES  
+// comp(proj(a), proj(b)).  64-; false -    
+template<typename RandomIt, typename Compare = less<>, typename Projection = IdentityProjection>
+bool sort_range(RandomIt first, RandomIt last, size_t algo_index, OperationCounts& ops,
+                Compare comp = {}, Projection proj = {}, int num_threads = 1) {
+    return sort_range_in_blocks(first, last, algo_index, ops, comp, proj, num_threads, SORT_RANGE_MAX_BLOCK);
+}
+
+// ====================   ====================
+
+// ,   ,      (Introsort  Timsort)
+const size_t AUTO_SORT_FALLBACK = 7;
+const size_t AUTO_SORT_STABLE_FALLBACK = 15;
+
+//      (   )
+const int PRESORTEDNESS_MIN_SAMPLE = 64;
+
+//    ,       "Few Unique"
+const double PRESORTEDNESS_FEW_UNIQUE = 0.5;
+
+//   "Nearly Sorted" (n/10  ):      
+const double PRESORTEDNESS_NEARLY_DESCENDING = 0.17;
+const double PRESORTEDNESS_NEARLY_INVERSIONS = 0.12;
+
+//     
+struct PresortednessProbe {
+    int sample_size = 0;            //   
+    double run_ratio = 0;           //      ( )
+    double descending_ratio = 0;    //      
+    double inversion_ratio = 0;     //      
+    double duplicate_ratio = 0;     //    : 1 -  / 
+    long long estimated_runs = 0;   //       
+    string distribution;            //   
+};
+
+//   ,    
+template<typename T>
+const char* sort_type_name() {
+    if constexpr (is_same_v<T, int>) return "int";
+    else if constexpr (is_same_v<T, double>) return "double";
+    else if constexpr (is_same_v<T, float>) return "float";
+    else if constexpr (is_same_v<T, string>) return "string";
+    else if constexpr (is_same_v<T, bool>) return "bool";
+    else if constexpr (is_same_v<T, string_view>) return "string_view";
+    else return "";
+}
+
+//    values ( i < j,  values[j] < values[i]); values 
+template<typename T>
+long long count_inversions(vector<T>& values) {
+    long long inversions = 0;
+    size_t n = values.size();
+    vector<T> buffer(n);
+
+    for (size_t width = 1; width < n; width *= 2) {
+        for (size_t left = 0; left < n; left += 2 * width) {
+            size_t mid = min(left + width, n);
+            size_t right = min(left + 2 * width, n);
+            size_t i = left;
+            size_t j = mid;
+            size_t k = left;
+            while (i < mid && j < right) {
+                if (values[j] < values[i]) {
+                    inversions += mid - i;
+                    buffer[k++] = values[j++];
+                } else {
+                    buffer[k++] = values[i++];
+                }
+            }
+            while (i < mid) buffer[k++] = values[i++];
+            while (j < right) buffer[k++] = values[j++];
+        }
+        values.swap(buffer);
+    }
+    return inversions;
+}
+
+//  :     O(sqrt(n))   
+template<typename T>
+PresortednessProbe probe_presortedness(const T arr[], int n) {
+    PresortednessProbe probe;
+    if (n < 2) {
+        probe.estimated_runs = n;
+        probe.distribution = "Sorted";
+        return probe;
+    }
+
+    int samples = min(n - 1, max(PRESORTEDNESS_MIN_SAMPLE, static_cast<int>(sqrt(static_cast<double>(n)))));
+    double stride = static_cast<double>(n - 1) / samples;
+    probe.sample_size = samples;
+
+    //     :     
+    vector<T> sample;
+    sample.reserve(samples);
+    int ascents = 0;
+    int descents = 0;
+    for (int s = 0; s < samples; s++) {
+        int pos = static_cast<int>(s * stride);
+        if (arr[pos] < arr[pos + 1]) ascents++;
+        else if (arr[pos + 1] < arr[pos]) descents++;
+        sample.push_back(arr[pos]);
+    }
+    probe.run_ratio = static_cast<double>(descents) / samples;
+    probe.estimated_runs = 1 + static_cast<long long>(probe.run_ratio * (n - 1));
+    probe.descending_ratio = ascents + descents > 0 ? static_cast<double>(descents) / (ascents + descents) : 0.0;
+
+    //     ( )    
+    long long inversions = count_inversions(sample);
+    long long equal_pairs = 0;
+    size_t distinct = 0;
+    for (size_t i = 0; i < sample.size(); ) {
+        size_t j = i + 1;
+        while (j < sample.size() && !(sample[i] < sample[j])) j++;
+        equal_pairs += static_cast<long long>(j - i) * (j - i - 1) / 2;
+        distinct++;
+        i = j;
+    }
+    long long pairs = static_cast<long long>(samples) * (samples - 1) / 2 - equal_pairs;
+    probe.inversion_ratio = pairs > 0 ? static_cast<double>(inversions) / pairs : 0.0;
+    probe.duplicate_ratio = 1.0 - static_cast<double>(distinct) / samples;
+
+    //   :  ,    
+    //  (  ,  );     - "Few Unique"
+    if (descents == 0 && inversions == 0) {
+        probe.distribution = "Sorted";
+    } else if (ascents == 0 && inversions == pairs) {
+        probe.distribution = "Reverse";
+    } else {
+        const char* shuffled = probe.duplicate_ratio >= PRESORTEDNESS_FEW_UNIQUE ? "Few Unique" : "Random";
+        const pair<const char*, pair<double, double>> centroids[] = {
+            {"Sorted", {0.0, 0.0}},
+            {"Nearly Sorted", {PRESORTEDNESS_NEARLY_DESCENDING, PRESORTEDNESS_NEARLY_INVERSIONS}},
+            {shuffled, {0.5, 0.5}},
+            {"Reverse", {1.0, 1.0}}
+        };
+        double best_distance = numeric_limits<double>::max();
+        for (const auto& [name, centroid] : centroids) {
+            double dx = probe.descending_ratio - centroid.first;
+            double dy = probe.inversion_ratio - centroid.second;
+            if (dx * dx + dy * dy < best_distance) {
+                best_distance = dx * dx + dy * dy;
+                probe.distribution = name;
+            }
+        }
+    }
+    return probe;
+}
+
+//   "Sorted"  "Reverse"        
+//   :        ,   
+//     .   "Sorted" 
+//  "Nearly Sorted", "Reverse" -  "Random"
+template<typename T>
+void confirm_presortedness(const T arr[], int n, PresortednessProbe& probe) {
+    if (probe.distribution == "Sorted") {
+        for (int i = 0; i + 1 < n; i++) {
+            if (arr[i + 1] < arr[i]) {
+                probe.distribution = "Nearly Sorted";
+                return;
+            }
+        }
+    } else if (probe.distribution == "Reverse") {
+        for (int i = 0; i + 1 < n; i++) {
+            if (arr[i] < arr[i + 1]) {
+                probe.distribution = "Random";
+                return;
+            }
+        }
+    }
+}
+
+//    ,    
+struct AutoSortEntry {
+    string type_name;
+    string distribution;
+    int size;                  //  
+    string fastest;            //   
+    string fastest_stable;     //     ( -  )
+};
+
+//  ,  AutoSorter::save_table   
+// (      main)
+const vector<AutoSortEntry> BUILTIN_AUTO_SORT_TABLE = {
+#include "auto_sort_table.inc"
+};
+
+//     :  ,    
+class AutoSorter {
+private:
+    //      
+    struct Candidate {
+        string name;
+        vector<double> times;  //    (0 -   )
+    };
+
+    vector<AutoSortEntry> table;
+    int num_threads;
+
+    //     
+    void add_distribution(const string& type_name, const string& distribution,
+                          const vector<int>& sizes, const vector<Candidate>& candidates) {
+        for (size_t i = 0; i < sizes.size(); i++) {
+            AutoSortEntry entry{type_name, distribution, sizes[i], "", ""};
+            double best_time = numeric_limits<double>::max();
+            double best_stable_time = numeric_limits<double>::max();
+
+            for (const auto& candidate : candidates) {
+                if (i >= candidate.times.size() || candidate.times[i] <= 0) continue;
+                size_t algo_index = find(SORT_ALGORITHM_NAMES.begin(), SORT_ALGORITHM_NAMES.end(), candidate.name) -
+                                    SORT_ALGORITHM_NAMES.begin();
+                if (algo_index == SORT_ALGORITHM_NAMES.size() ||
+                    is_sort_algorithm_key_range_dependent(algo_index, type_name)) continue;
+
+                if (candidate.times[i] < best_time) {
+                    best_time = candidate.times[i];
+                    entry.fastest = candidate.name;
+                }
+                if (is_sort_algorithm_stable(algo_index) && candidate.times[i] < best_stable_time) {
+                    best_stable_time = candidate.times[i];
+                    entry.fastest_stable = candidate.name;
+                }
+            }
+
+            if (!entry.fastest.empty()) table.push_back(entry);
+        }
+    }
+
+    //    n:     n,   ( 
+    //       choose)
+    const AutoSortEntry* find_entry(const string& type_name, const string& distribution, int n) const {
+        const AutoSortEntry* best = nullptr;
+        for (const auto& entry : table) {
+            if (entry.type_name != type_name || entry.distribution != distribution) continue;
+            if (!best) {
+                best = &entry;
+            } else if (entry.size >= n) {
+                if (best->size < n || entry.size < best->size) best = &entry;
+            } else if (best->size < n && entry.size > best->size) {
+                best = &entry;
+            }
+        }
+        return best;
+    }
+
+    //    JSON: "key": "value"
+    static string json_string_value(const string& line, size_t colon) {
+        size_t start = line.find('"', colon);
+        size_t end = line.find('"', start + 1);
+        if (start == string::npos || end == string::npos) return "";
+        return line.substr(start + 1, end - start - 1);
+    }
+
+    //   JSON   : "key": [a, b, c]
+    static vector<double> json_number_array(const string& line, size_t colon) {
+        vector<double> values;
+        size_t start = line.find('[', colon);
+        size_t end = line.find(']', start);
+        if (start == string::npos || end == string::npos) return values;
+
+        string items = line.substr(start + 1, end - start - 1);
+        replace(items.begin(), items.end(), ',', ' ');
+        istringstream stream(items);
+        double value;
+        while (stream >> value) {
+            values.push_back(value);
         }
+        return values;
     }
 
-    void setDistribution(int dist) {
-        if (dist >= 0 && static_cast<size_t>(dist) < distributions.size()) {
-            current_distribution = dist;
-            InvalidateRect(hwnd, NULL, TRUE);
+public:
+    explicit AutoSorter(int threads = 1, const vector<AutoSortEntry>& entries = BUILTIN_AUTO_SORT_TABLE)
+        : table(entries), num_threads(max(1, threads)) {}
+
+    //       
+    void add_results(const vector<DataTypeAnalysis>& results) {
+        for (const auto& analysis : results) {
+            for (const auto& [distribution, algorithms] : analysis.algorithms_by_distribution) {
+                vector<Candidate> candidates;
+                for (const auto& algo : algorithms) {
+                    candidates.push_back({algo.name, algo.times_by_size});
+                }
+                add_distribution(analysis.type_name, distribution, analysis.test_sizes, candidates);
+            }
         }
     }
 
-    static LRESULT CALLBACK TableWindowProc(HWND hwnd, UINT uMsg, WPARAM wParam, LPARAM lParam) {
-        ResultsTableWindow* pThis = (ResultsTableWindow*)GetWindowLongPtr(hwnd, GWLP_USERDATA);
+    //    ResultsSaver ( :    )
+    bool load_json(const string& filename) {
+        ifstream file(filename);
+        if (!file.is_open()) {
+            cerr << "Error: Cannot open file " << filename << " for reading" << endl;
+            return false;
+        }
 
-        switch (uMsg) {
-            case WM_PAINT:
-                if (pThis) pThis->drawTable();
-                break;
+        string line;
+        string type_name;
+        string distribution;
+        string name;
+        bool in_distributions = false;
+        vector<int> sizes;
+        vector<Candidate> candidates;
+        size_t loaded_before = table.size();
+
+        auto flush_distribution = [&]() {
+            if (!candidates.empty()) {
+                add_distribution(type_name, distribution, sizes, candidates);
+                candidates.clear();
+            }
+        };
 
-            case WM_KEYDOWN:
-                if (pThis) {
-                    if (wParam == 'Q') pThis->setDataType(0);
-                    else if (wParam == 'W') pThis->setDataType(1);
-                    else if (wParam == 'E') pThis->setDataType(2);
-                    else if (wParam == 'R') pThis->setDataType(3);
-                    else if (wParam == 'T') pThis->setDataType(4);
-                    else if (wParam == 'A') pThis->setDistribution(0);
-                    else if (wParam == 'S') pThis->setDistribution(1);
-                    else if (wParam == 'D') pThis->setDistribution(2);
-                    else if (wParam == 'F') pThis->setDistribution(3);
-                    else if (wParam == 'G') pThis->setDistribution(4);
-                    else if (wParam == VK_ESCAPE) DestroyWindow(hwnd);
+        while (getline(file, line)) {
+            size_t key_start = line.find('"');
+            size_t key_end = key_start == string::npos ? string::npos : line.find('"', key_start + 1);
+            size_t colon = key_end == string::npos ? string::npos : line.find(':', key_end);
+            if (colon == string::npos) continue;
+
+            string key = line.substr(key_start + 1, key_end - key_start - 1);
+            if (key == "type_name") {
+                flush_distribution();
+                type_name = json_string_value(line, colon);
+                in_distributions = false;
+            } else if (key == "test_sizes") {
+                sizes.clear();
+                for (double size : json_number_array(line, colon)) {
+                    sizes.push_back(static_cast<int>(size));
                 }
-                break;
+            } else if (key == "algorithms_by_distribution") {
+                in_distributions = true;
+            } else if (key == "scaling") {
+                flush_distribution();
+                in_distributions = false;
+            } else if (in_distributions) {
+                if (line.find_last_not_of(" \r") == line.rfind('[')) {
+                    flush_distribution();
+                    distribution = key;
+                } else if (key == "name") {
+                    name = json_string_value(line, colon);
+                } else if (key == "times_by_size") {
+                    candidates.push_back({name, json_number_array(line, colon)});
+                }
+            }
+        }
+        flush_distribution();
 
-            case WM_DESTROY:
-                PostQuitMessage(0);
-                break;
+        if (table.size() == loaded_before) {
+            cerr << "Error: No benchmark results found in " << filename << endl;
+            return false;
+        }
+        return true;
+    }
 
-            default:
-                return DefWindowProc(hwnd, uMsg, wParam, lParam);
+    //      AutoSortEntry   
+    bool save_table(const string& filename) const {
+        ofstream file(filename);
+        if (!file.is_open()) {
+            cerr << "Error: Cannot open file " << filename << " for writing" << endl;
+            return false;
         }
-        return 0;
+
+        file << "// Generated by AutoSorter::save_table: {type, distribution, size, fastest, fastest stable}\n";
+        for (const auto& entry : table) {
+            file << "{\"" << entry.type_name << "\", \"" << entry.distribution << "\", " << entry.size
+                 << ", \"" << entry.fastest << "\", \"" << entry.fastest_stable << "\"},\n";
+        }
+        return true;
     }
 
-    void runMessageLoop() {
-        MSG msg = {};
-        while (GetMessage(&msg, NULL, 0, 0)) {
-            TranslateMessage(&msg);
-            DispatchMessage(&msg);
+    //   
+    size_t size() const {
+        return table.size();
+    }
+
+    //     ( SORT_ALGORITHM_NAMES)
+    template<typename T>
+    size_t choose(const T arr[], int n, bool stable = false) const {
+        PresortednessProbe probe = probe_presortedness(arr, n);
+        confirm_presortedness(arr, n, probe);
+        const AutoSortEntry* entry = find_entry(sort_type_name<T>(), probe.distribution, n);
+        if (!entry) return stable ? AUTO_SORT_STABLE_FALLBACK : AUTO_SORT_FALLBACK;
+
+        const string& name = stable ? entry->fastest_stable : entry->fastest;
+        size_t algo_index = find(SORT_ALGORITHM_NAMES.begin(), SORT_ALGORITHM_NAMES.end(), name) -
+                            SORT_ALGORITHM_NAMES.begin();
+        if (algo_index == SORT_ALGORITHM_NAMES.size() || !is_sort_algorithm_applicable<T>(algo_index) ||
+            is_sort_algorithm_key_range_dependent(algo_index, sort_type_name<T>()) ||
+            (entry->size < n && is_sort_algorithm_quadratic(algo_index))) {
+            return stable ? AUTO_SORT_STABLE_FALLBACK : AUTO_SORT_FALLBACK;
         }
+        return algo_index;
+    }
+
+    //   ;   
+    template<typename T>
+    const string& sort(T arr[], int n, OperationCounts& ops, bool stable = false) const {
+        size_t algo_index = choose(arr, n, stable);
+        run_sort_algorithm(algo_index, arr, n, num_threads, ops);
+        return SORT_ALGORITHM_NAMES[algo_index];
+    }
+
+    template<typename T>
+    const string& sort(T arr[], int n, bool stable = false) const {
+        OperationCounts ops;
+        return sort(arr, n, ops, stable);
     }
 };
 
+//           
+template<typename T>
+const string& auto_sort(T arr[], int n, bool stable = false) {
+    static const AutoSorter sorter(static_cast<int>(thread::hardware_concurrency()));
+    return sorter.sort(arr, n, stable);
+}
+
 //   
 class ComprehensiveAnalyzer {
 private:
     vector<int> test_sizes;
-    vector<string> data_types = {"int", "double", "float", "string", "bool"};
+    vector<string> data_types = {"int", "double", "float", "string", "bool", "string_view"};
     vector<string> distributions = {
         "Random",
         "Sorted",
@@ -1668,7 +6366,34 @@ private:
         "Nearly Sorted",
         "Few Unique"
     };
+    vector<string> algorithm_names = SORT_ALGORITHM_NAMES;
+    vector<string> parallel_algorithm_names = {
+        "Parallel Quick",
+        "Parallel Merge",
+        "Parallel Sample",
+        "Parallel Radix"
+    };
+    vector<string> kway_merge_algorithm_names = {
+        "Loser Tree",
+        "Binary Heap",
+        "Pairwise Merge"
+    };
+    vector<string> small_sort_algorithm_names = {
+        "Insertion",
+        "Sorting Network",
+        "Small Sort",
+        "std::sort"
+    };
+    vector<string> selection_algorithm_names = {
+        "nth_element",
+        "Partial Heap",
+        "Partial Select",
+        "Streaming Top-k",
+        "Full std::sort"
+    };
     int num_threads;
+    long long external_elements = 0;   //    (0 -  )
+    size_t external_memory_limit = 0;  //      ()
 
     //   
     double calculate_cache_efficiency(const vector<int>& accessed_indices, int array_size) {
@@ -1683,18 +6408,14 @@ private:
         return static_cast<double>(spatial_locality) / accessed_indices.size();
     }
 
+
     //       
     template<typename T>
     vector<AlgorithmResult> analyze_data_type(int data_type_index, int distribution_type) {
-        vector<AlgorithmResult> algorithms = {
-            AlgorithmResult("Bubble"),
-            AlgorithmResult("Selection"),
-            AlgorithmResult("Insertion"),
-            AlgorithmResult("Quick"),
-            AlgorithmResult("Merge"),
-            AlgorithmResult("Heap"),
-            AlgorithmResult("std::sort")
-        };
+        vector<AlgorithmResult> algorithms;
+        for (const auto& name : algorithm_names) {
+            algorithms.push_back(AlgorithmResult(name));
+        }
 
         //   
         algorithms[0].complexity = "O(n^2)";
@@ -1704,14 +6425,44 @@ private:
         algorithms[4].complexity = "O(n log n)";
         algorithms[5].complexity = "O(n log n)";
         algorithms[6].complexity = "O(n log n)";
+        algorithms[7].complexity = "O(n log n)";
+        algorithms[8].complexity = "O(n log n / p)";
+        algorithms[9].complexity = "O(n log n / p)";
+        algorithms[10].complexity = "O(n log n)";
+        algorithms[11].complexity = "O(w n)";
+        algorithms[12].complexity = "O(n + D)";
+        algorithms[13].complexity = "O(n + k)";
+        algorithms[14].complexity = "O(n log n)";
+        algorithms[15].complexity = "O(n log n)";
+        algorithms[16].complexity = "O(n log n)";
+        algorithms[17].complexity = "O(n log n)";
+        algorithms[18].complexity = "O(n log n)";
+        algorithms[19].complexity = "O(n log n)";
+        algorithms[20].complexity = "O(n log n)";
+        algorithms[21].complexity = "O(n log n)";
+        algorithms[22].complexity = "O(n log n + D)";
+        algorithms[23].complexity = "O(w n / p)";
 
         //   
         for (size_t algo_index = 0; algo_index < algorithms.size(); algo_index++) {
+            //  ,    
+            if (!is_sort_algorithm_applicable<T>(algo_index)) continue;
+
+            //  ,    ,    
+            int max_size = *max_element(test_sizes.begin(), test_sizes.end());
+            if (is_parallel_sort_fallback(algo_index, max_size, num_threads)) continue;
+
             cout << "  " << data_types[data_type_index] << " - " << algorithms[algo_index].name << "...\n";
 
             StatisticalResults stats;
             vector<double> times_for_sizes;
 
+            //      (  )
+            bool argsort_applicable = is_sort_algorithm_applicable<ArgsortIndex<T>>(algo_index);
+            double argsort_total = 0.0;
+            double gather_total = 0.0;
+            int argsort_runs = 0;
+
             //     
             for (size_t i = 0; i < test_sizes.size(); i++) {
                 int size = test_sizes[i];
@@ -1722,25 +6473,47 @@ private:
                     continue;
                 }
 
+                //  ,      
+                // (     )
+                if (is_parallel_sort_fallback(algo_index, size, num_threads)) {
+                    times_for_sizes.push_back(0.0);
+                    continue;
+                }
+
                 DetailedMetrics metrics;
                 OperationCounts ops;
 
-                T* test_data = create_array<T>(size, distribution_type);
+                TestArray<T> test_array = create_array<T>(size, distribution_type);
+                T* test_data = test_array.data();
+                T* argsort_data = nullptr;
+                if (argsort_applicable) {
+                    argsort_data = new T[size];
+                    copy(test_data, test_data + size, argsort_data);
+                }
 
                 auto start = chrono::high_resolution_clock::now();
 
                 //    
-                switch (algo_index) {
-                    case 0: bubble_sort_instrumented(test_data, size, ops); break;
-                    case 1: selection_sort_instrumented(test_data, size, ops); break;
-                    case 2: insertion_sort_instrumented(test_data, size, ops); break;
-                    case 3: quick_sort_instrumented(test_data, size, ops); break;
-                    case 4: merge_sort_instrumented(test_data, size, ops); break;
-                    case 5: heap_sort_instrumented(test_data, size, ops); break;
-                    case 6: std_sort_instrumented(test_data, size, ops); break;
-                }
+                run_sort_algorithm(algo_index, test_data, size, num_threads, ops);
 
                 auto end = chrono::high_resolution_clock::now();
+
+                if (argsort_applicable) {
+                    OperationCounts argsort_ops;
+                    auto argsort_start = chrono::high_resolution_clock::now();
+                    vector<uint32_t> permutation = argsort_instrumented(argsort_data, size,
+                        [this, algo_index](ArgsortIndex<T> indices[], int count, OperationCounts& index_ops) {
+                            run_sort_algorithm(algo_index, indices, count, num_threads, index_ops);
+                        }, argsort_ops);
+                    auto gather_start = chrono::high_resolution_clock::now();
+                    apply_permutation_instrumented(argsort_data, permutation, argsort_ops);
+                    auto gather_end = chrono::high_resolution_clock::now();
+
+                    argsort_total += chrono::duration<double>(gather_start - argsort_start).count();
+                    gather_total += chrono::duration<double>(gather_end - gather_start).count();
+                    argsort_runs++;
+                    delete[] argsort_data;
+                }
                 metrics.time = chrono::duration<double>(end - start).count();
                 metrics.operations = ops;
                 metrics.memory_used = ops.extra_memory;
@@ -1750,8 +6523,6 @@ private:
                 stats.all_measurements.push_back(metrics.time);
                 times_for_sizes.push_back(metrics.time);
 
-                delete[] test_data;
-
                 //   
                 ops.accessed_indices.clear();
                 ops.accessed_indices.shrink_to_fit();
@@ -1764,27 +6535,451 @@ private:
 
             algorithms[algo_index].calculateAverageOperations();
 
-            //  
-            if (algo_index == 2 || algo_index == 4) {
-                algorithms[algo_index].stable = true;
-            } else if (algo_index == 6) {
-                algorithms[algo_index].stable = true;
-            } else {
-                algorithms[algo_index].stable = false;
+            if (argsort_runs > 0) {
+                algorithms[algo_index].has_argsort = true;
+                algorithms[algo_index].argsort_time = argsort_total / argsort_runs;
+                algorithms[algo_index].gather_time = gather_total / argsort_runs;
             }
 
+            //  
+            algorithms[algo_index].stable = is_sort_algorithm_stable(algo_index);
+
             //   
             algorithms[algo_index].metrics.clear();
             algorithms[algo_index].metrics.shrink_to_fit();
         }
 
+        //    (     )
+        algorithms.erase(remove_if(algorithms.begin(), algorithms.end(),
+                                   [](const AlgorithmResult& algo) {
+                                       return all_of(algo.times_by_size.begin(), algo.times_by_size.end(),
+                                                     [](double time) { return time <= 0; });
+                                   }),
+                         algorithms.end());
+
         return algorithms;
     }
 
+    //       
+    template<typename T>
+    void run_parallel_algorithm(size_t parallel_index, T arr[], int n, int threads, OperationCounts& ops) {
+        switch (parallel_index) {
+            case 0: parallel_quick_sort_instrumented(arr, n, threads, ops); break;
+            case 1: parallel_merge_sort_instrumented(arr, n, threads, ops); break;
+            case 2: parallel_sample_sort_instrumented(arr, n, threads, ops); break;
+            case 3:
+                if constexpr (is_radix_sortable_v<T>) parallel_radix_sort_instrumented(arr, n, threads, ops);
+                break;
+        }
+    }
+
+    //      1  num_threads 
+    template<typename T>
+    vector<ScalingResult> analyze_scaling(int data_type_index) {
+        vector<int> thread_counts;
+        for (int threads = 1; threads < num_threads; threads *= 2) {
+            thread_counts.push_back(threads);
+        }
+        thread_counts.push_back(num_threads);
+
+        vector<ScalingResult> scaling;
+
+        for (size_t parallel_index = 0; parallel_index < parallel_algorithm_names.size(); parallel_index++) {
+            //   -    
+            if (parallel_index == 3 && !is_radix_sortable_v<T>) continue;
+
+            ScalingResult result;
+            result.name = parallel_algorithm_names[parallel_index];
+            result.array_size = SCALING_ARRAY_SIZE;
+
+            cout << "  " << data_types[data_type_index] << " - " << result.name << " scaling:";
+
+            for (int threads : thread_counts) {
+                double best_time = numeric_limits<double>::max();
+                vector<pair<string, double>> best_phases;
+
+                //       
+                for (int repeat = 0; repeat < SCALING_REPEATS; repeat++) {
+                    OperationCounts ops;
+                    TestArray<T> test_array = create_array<T>(result.array_size, 0);
+                    T* test_data = test_array.data();
+
+                    auto start = chrono::high_resolution_clock::now();
+                    run_parallel_algorithm(parallel_index, test_data, result.array_size, threads, ops);
+                    auto end = chrono::high_resolution_clock::now();
+
+                    double time = chrono::duration<double>(end - start).count();
+                    if (time < best_time) {
+                        best_time = time;
+                        best_phases = ops.phase_times;
+                    }
+                }
+
+                result.thread_counts.push_back(threads);
+                result.times.push_back(best_time);
+                result.speedups.push_back(result.times[0] / max(best_time, 1e-10));
+
+                //    
+                for (const auto& phase : best_phases) {
+                    size_t phase_index = find(result.phase_names.begin(), result.phase_names.end(), phase.first) -
+                                         result.phase_names.begin();
+                    if (phase_index == result.phase_names.size()) {
+                        result.phase_names.push_back(phase.first);
+                        result.phase_times.emplace_back(result.thread_counts.size() - 1, 0.0);
+                    }
+                    result.phase_times[phase_index].push_back(phase.second);
+                }
+
+                cout << " " << threads << "t=" << fixed << setprecision(2) << result.speedups.back() << "x";
+            }
+            cout << defaultfloat << endl;
+
+            //     
+            if (!result.phase_names.empty()) {
+                cout << "    phases at " << thread_counts.back() << "t:";
+                for (size_t phase = 0; phase < result.phase_names.size(); phase++) {
+                    cout << " " << result.phase_names[phase] << "=" << fixed << setprecision(4)
+                         << result.phase_times[phase].back() << "s";
+                }
+                cout << defaultfloat << endl;
+            }
+
+            scaling.push_back(result);
+        }
+
+        return scaling;
+    }
+
+    //    k 
+    template<typename T>
+    void run_selection_algorithm(size_t selection_index, T arr[], int n, int k, OperationCounts& ops) {
+        switch (selection_index) {
+            case 0: introselect_instrumented(arr, n, k - 1, ops); break;
+            case 1: partial_sort_heap_instrumented(arr, n, k, ops); break;
+            case 2: partial_sort_select_instrumented(arr, n, k, ops); break;
+            case 3: {
+                T* top = new T[k];
+                streaming_top_k_instrumented(arr, n, k, top, ops);
+                delete[] top;
+                break;
+            }
+            case 4: std_sort_instrumented(arr, n, ops); break;
+        }
+    }
+
+    //   k    k   
+    template<typename T>
+    vector<SelectionResult> analyze_selection(int data_type_index) {
+        vector<SelectionResult> selection;
+
+        for (int dist = 0; dist < static_cast<int>(distributions.size()); dist++) {
+            cout << "  " << data_types[data_type_index] << " - Selection (" << distributions[dist] << "), k/n:";
+            for (double fraction : SELECTION_K_FRACTIONS) {
+                cout << " " << fraction;
+            }
+            cout << endl;
+
+            for (size_t selection_index = 0; selection_index < selection_algorithm_names.size(); selection_index++) {
+                SelectionResult result;
+                result.name = selection_algorithm_names[selection_index];
+                result.distribution = distributions[dist];
+                result.array_size = SELECTION_ARRAY_SIZE;
+
+                cout << "    " << result.name << ":";
+
+                for (double fraction : SELECTION_K_FRACTIONS) {
+                    int k = max(1, static_cast<int>(fraction * result.array_size));
+                    double best_time = numeric_limits<double>::max();
+
+                    for (int repeat = 0; repeat < SELECTION_REPEATS; repeat++) {
+                        OperationCounts ops;
+                        TestArray<T> test_array = create_array<T>(result.array_size, dist);
+                        T* test_data = test_array.data();
+
+                        auto start = chrono::high_resolution_clock::now();
+                        run_selection_algorithm(selection_index, test_data, result.array_size, k, ops);
+                        auto end = chrono::high_resolution_clock::now();
+
+                        best_time = min(best_time, chrono::duration<double>(end - start).count());
+                    }
+
+                    result.k_fractions.push_back(fraction);
+                    result.times.push_back(best_time);
+                    cout << " " << fixed << setprecision(5) << best_time;
+                }
+                cout << defaultfloat << endl;
+
+                selection.push_back(result);
+            }
+        }
+
+        return selection;
+    }
+
+    //     
+    template<typename T>
+    void run_small_sort_algorithm(size_t small_index, T arr[], int n, OperationCounts& ops) {
+        switch (small_index) {
+            case 0: insertion_sort_instrumented(arr, n, ops); break;
+            case 1: sorting_network_sort_instrumented(arr, n, ops); break;
+            case 2: small_sort_instrumented(arr, n, ops); break;
+            case 3: std_sort_instrumented(arr, n, ops); break;
+        }
+    }
+
+    //     2..SORTING_NETWORK_MAX:   
+    //  SMALL_SORT_BATCH  (     10)
+    template<typename T>
+    vector<SmallSortResult> analyze_small_sizes(int data_type_index) {
+        vector<SmallSortResult> small_sizes;
+
+        for (int dist = 0; dist < static_cast<int>(distributions.size()); dist++) {
+            vector<SmallSortResult> results(small_sort_algorithm_names.size());
+            for (size_t small_index = 0; small_index < results.size(); small_index++) {
+                results[small_index].name = small_sort_algorithm_names[small_index];
+                results[small_index].distribution = distributions[dist];
+            }
+
+            for (int size = 2; size <= SORTING_NETWORK_MAX; size++) {
+                vector<TestArray<T>> originals(SMALL_SORT_BATCH);
+                for (auto& original : originals) {
+                    original = create_array<T>(size, dist);
+                }
+
+                for (size_t small_index = 0; small_index < results.size(); small_index++) {
+                    //      ,     
+                    T* batch = new T[static_cast<size_t>(size) * SMALL_SORT_BATCH];
+                    for (int i = 0; i < SMALL_SORT_BATCH; i++) {
+                        copy(originals[i].data(), originals[i].data() + size, batch + static_cast<size_t>(i) * size);
+                    }
+
+                    OperationCounts ops;
+                    auto start = chrono::high_resolution_clock::now();
+                    for (int i = 0; i < SMALL_SORT_BATCH; i++) {
+                        run_small_sort_algorithm(small_index, batch + static_cast<size_t>(i) * size, size, ops);
+                    }
+                    auto end = chrono::high_resolution_clock::now();
+
+                    results[small_index].sizes.push_back(size);
+                    results[small_index].times.push_back(chrono::duration<double>(end - start).count() / SMALL_SORT_BATCH);
+                    delete[] batch;
+                }
+            }
+
+            cout << "  " << data_types[data_type_index] << " - Small sizes (" << distributions[dist]
+                 << "), ns per array at n=2/4/8/16/32:" << endl;
+            for (const auto& result : results) {
+                cout << "    " << result.name << ":";
+                for (int size : {2, 4, 8, 16, 32}) {
+                    cout << " " << static_cast<long long>(result.times[size - 2] * 1e9);
+                }
+                cout << endl;
+                small_sizes.push_back(result);
+            }
+        }
+
+        return small_sizes;
+    }
+
+    //   k- 
+    template<typename T>
+    void run_kway_merge_algorithm(size_t merge_index, T arr[], const vector<int>& run_starts, T out[],
+                                  OperationCounts& ops) {
+        switch (merge_index) {
+            case 0: loser_tree_merge_instrumented(arr, run_starts, out, ops); break;
+            case 1: heap_kway_merge_instrumented(arr, run_starts, out, ops); break;
+            case 2: pairwise_kway_merge_instrumented(arr, run_starts, out, ops); break;
+        }
+    }
+
+    //   k   ( )   k   
+    template<typename T>
+    vector<KWayMergeResult> analyze_kway_merge(int data_type_index) {
+        vector<KWayMergeResult> kway_merge;
+
+        for (int run_length : KWAY_MERGE_RUN_LENGTHS) {
+            vector<KWayMergeResult> results(kway_merge_algorithm_names.size());
+            for (size_t merge_index = 0; merge_index < results.size(); merge_index++) {
+                results[merge_index].name = kway_merge_algorithm_names[merge_index];
+                results[merge_index].run_length = run_length;
+            }
+
+            for (int k : KWAY_MERGE_FAN_INS) {
+                if (static_cast<long long>(k) * run_length > KWAY_MERGE_MAX_ELEMENTS) break;
+                int total = k * run_length;
+
+                vector<int> run_starts;
+                for (int run = 0; run <= k; run++) {
+                    run_starts.push_back(run * run_length);
+                }
+                TestArray<T> runs_array = create_array<T>(total, 0);
+                T* runs = runs_array.data();
+                for (int run = 0; run < k; run++) {
+                    sort(runs + run_starts[run], runs + run_starts[run + 1]);
+                }
+
+                for (size_t merge_index = 0; merge_index < results.size(); merge_index++) {
+                    double best_time = numeric_limits<double>::max();
+                    long long comparisons = 0;
+
+                    for (int repeat = 0; repeat < KWAY_MERGE_REPEATS; repeat++) {
+                        T* input = new T[total];
+                        T* output = new T[total];
+                        copy(runs, runs + total, input);
+
+                        OperationCounts ops;
+                        auto start = chrono::high_resolution_clock::now();
+                        run_kway_merge_algorithm(merge_index, input, run_starts, output, ops);
+                        auto end = chrono::high_resolution_clock::now();
+
+                        best_time = min(best_time, chrono::duration<double>(end - start).count());
+                        comparisons = ops.comparisons;
+                        delete[] input;
+                        delete[] output;
+                    }
+
+                    results[merge_index].fan_ins.push_back(k);
+                    results[merge_index].times.push_back(best_time);
+                    results[merge_index].comparisons.push_back(static_cast<double>(comparisons) / total);
+                }
+            }
+
+            cout << "  " << data_types[data_type_index] << " - K-way merge (runs of " << run_length
+                 << "), time / comparisons per element for k =";
+            for (int k : results[0].fan_ins) {
+                cout << " " << k;
+            }
+            cout << ":" << endl;
+            for (const auto& result : results) {
+                cout << "    " << result.name << ":";
+                for (size_t i = 0; i < result.fan_ins.size(); i++) {
+                    cout << " " << fixed << setprecision(5) << result.times[i]
+                         << "/" << setprecision(1) << result.comparisons[i];
+                }
+                cout << defaultfloat << endl;
+                kway_merge.push_back(result);
+            }
+        }
+
+        return kway_merge;
+    }
+
+    //         
+    //     
+    template<typename T>
+    vector<PresortednessResult> analyze_presortedness(int data_type_index) {
+        vector<PresortednessResult> presortedness;
+
+        for (int size : PRESORTEDNESS_ARRAY_SIZES) {
+            for (int dist = 0; dist < static_cast<int>(distributions.size()); dist++) {
+                PresortednessResult result;
+                result.distribution = distributions[dist];
+                result.array_size = size;
+                int correct = 0;
+
+                for (int trial = 0; trial < PRESORTEDNESS_TRIALS; trial++) {
+                    TestArray<T> test_array = create_array<T>(size, dist);
+                    T* test_data = test_array.data();
+
+                    auto probe_start = chrono::high_resolution_clock::now();
+                    PresortednessProbe probe = probe_presortedness(test_data, size);
+                    auto probe_end = chrono::high_resolution_clock::now();
+
+                    OperationCounts ops;
+                    introsort_instrumented(test_data, size, ops);
+                    auto sort_end = chrono::high_resolution_clock::now();
+
+                    result.probe_time += chrono::duration<double>(probe_end - probe_start).count();
+                    result.sort_time += chrono::duration<double>(sort_end - probe_end).count();
+                    result.descending_ratio += probe.descending_ratio;
+                    result.inversion_ratio += probe.inversion_ratio;
+                    result.duplicate_ratio += probe.duplicate_ratio;
+                    result.estimated_runs += probe.estimated_runs;
+                    if (probe.distribution == distributions[dist]) correct++;
+
+                }
+
+                result.probe_time /= PRESORTEDNESS_TRIALS;
+                result.sort_time /= PRESORTEDNESS_TRIALS;
+                result.accuracy = static_cast<double>(correct) / PRESORTEDNESS_TRIALS;
+                result.descending_ratio /= PRESORTEDNESS_TRIALS;
+                result.inversion_ratio /= PRESORTEDNESS_TRIALS;
+                result.duplicate_ratio /= PRESORTEDNESS_TRIALS;
+                result.estimated_runs /= PRESORTEDNESS_TRIALS;
+
+                cout << "  " << data_types[data_type_index] << " - Presortedness (" << result.distribution
+                     << ", n=" << size << "): accuracy=" << static_cast<int>(result.accuracy * 100) << "%"
+                     << fixed << setprecision(6) << " probe=" << result.probe_time << "s"
+                     << setprecision(3) << " (" << 100.0 * result.probe_time / max(result.sort_time, 1e-10)
+                     << "% of sort) desc=" << result.descending_ratio << " inv=" << result.inversion_ratio
+                     << " dup=" << result.duplicate_ratio << defaultfloat << endl;
+
+                presortedness.push_back(result);
+            }
+        }
+
+        return presortedness;
+    }
+
+    //      
+    template<typename T>
+    vector<ExternalSortResult> analyze_external(int data_type_index) {
+        vector<ExternalSortResult> external;
+        if (external_elements <= 0) return external;
+
+        string input_path = "external_" + data_types[data_type_index] + "_input.bin";
+        string output_path = "external_" + data_types[data_type_index] + "_sorted.bin";
+
+        for (int dist = 0; dist < static_cast<int>(distributions.size()); dist++) {
+            ExternalSortResult result;
+            result.distribution = distributions[dist];
+
+            cout << "  " << data_types[data_type_index] << " - External Merge (" << distributions[dist] << ")...";
+
+            if (!create_external_input<T>(input_path, external_elements, dist)) {
+                cout << " failed to create input file" << endl;
+                remove(input_path.c_str());
+                continue;
+            }
+
+            OperationCounts ops;
+            bool success = external_merge_sort<T>(input_path, output_path, external_memory_limit, result, ops);
+            remove(input_path.c_str());
+            remove(output_path.c_str());
+
+            if (!success) {
+                cout << " I/O error" << endl;
+                continue;
+            }
+
+            cout << " runs=" << result.runs << " passes=" << result.merge_passes
+                 << " read=" << result.bytes_read / (1024 * 1024) << "MB"
+                 << " written=" << result.bytes_written / (1024 * 1024) << "MB"
+                 << fixed << setprecision(3)
+                 << " io=" << result.io_time << "s cpu=" << result.cpu_time << "s"
+                 << defaultfloat << endl;
+
+            external.push_back(result);
+        }
+
+        return external;
+    }
+
 public:
     ComprehensiveAnalyzer(const vector<int>& sizes, int threads)
         : test_sizes(sizes), num_threads(threads) {}
 
+    //   : elements   memory_limit  
+    void set_external_sort(long long elements, size_t memory_limit) {
+        external_elements = elements;
+        external_memory_limit = memory_limit;
+    }
+
+    //   
+    int get_algorithm_count() const {
+        return static_cast<int>(algorithm_names.size());
+    }
+
     //   
     vector<DataTypeAnalysis> run_comprehensive_analysis() {
         cout << "\n=== STARTING COMPREHENSIVE ANALYSIS ===\n";
@@ -1813,6 +7008,7 @@ public:
                     case 2: algorithms = analyze_data_type<float>(data_type, dist); break;
                     case 3: algorithms = analyze_data_type<string>(data_type, dist); break;
                     case 4: algorithms = analyze_data_type<bool>(data_type, dist); break;
+                    case 5: algorithms = analyze_data_type<string_view>(data_type, dist); break;
                 }
 
                 //   
@@ -1832,6 +7028,67 @@ public:
                 }
             }
 
+            //   
+            switch (data_type) {
+                case 0: analysis.scaling = analyze_scaling<int>(data_type); break;
+                case 1: analysis.scaling = analyze_scaling<double>(data_type); break;
+                case 2: analysis.scaling = analyze_scaling<float>(data_type); break;
+                case 3: analysis.scaling = analyze_scaling<string>(data_type); break;
+                case 4: analysis.scaling = analyze_scaling<bool>(data_type); break;
+                case 5: analysis.scaling = analyze_scaling<string_view>(data_type); break;
+            }
+
+            //  k    
+            switch (data_type) {
+                case 0: analysis.selection = analyze_selection<int>(data_type); break;
+                case 1: analysis.selection = analyze_selection<double>(data_type); break;
+                case 2: analysis.selection = analyze_selection<float>(data_type); break;
+                case 3: analysis.selection = analyze_selection<string>(data_type); break;
+                case 4: analysis.selection = analyze_selection<bool>(data_type); break;
+                case 5: analysis.selection = analyze_selection<string_view>(data_type); break;
+            }
+
+            //  :      std::sort
+            switch (data_type) {
+                case 0: analysis.small_sizes = analyze_small_sizes<int>(data_type); break;
+                case 1: analysis.small_sizes = analyze_small_sizes<double>(data_type); break;
+                case 2: analysis.small_sizes = analyze_small_sizes<float>(data_type); break;
+                case 3: analysis.small_sizes = analyze_small_sizes<string>(data_type); break;
+                case 4: analysis.small_sizes = analyze_small_sizes<bool>(data_type); break;
+                case 5: analysis.small_sizes = analyze_small_sizes<string_view>(data_type); break;
+            }
+
+            // k- :       
+            switch (data_type) {
+                case 0: analysis.kway_merge = analyze_kway_merge<int>(data_type); break;
+                case 1: analysis.kway_merge = analyze_kway_merge<double>(data_type); break;
+                case 2: analysis.kway_merge = analyze_kway_merge<float>(data_type); break;
+                case 3: analysis.kway_merge = analyze_kway_merge<string>(data_type); break;
+                case 4: analysis.kway_merge = analyze_kway_merge<bool>(data_type); break;
+                case 5: analysis.kway_merge = analyze_kway_merge<string_view>(data_type); break;
+            }
+
+            //     
+            switch (data_type) {
+                case 0: analysis.presortedness = analyze_presortedness<int>(data_type); break;
+                case 1: analysis.presortedness = analyze_presortedness<double>(data_type); break;
+                case 2: analysis.presortedness = analyze_presortedness<float>(data_type); break;
+                case 3: analysis.presortedness = analyze_presortedness<string>(data_type); break;
+                case 4: analysis.presortedness = analyze_presortedness<bool>(data_type); break;
+                case 5: analysis.presortedness = analyze_presortedness<string_view>(data_type); break;
+            }
+
+            //   
+            switch (data_type) {
+                case 0: analysis.external = analyze_external<int>(data_type); break;
+                case 1: analysis.external = analyze_external<double>(data_type); break;
+                case 2: analysis.external = analyze_external<float>(data_type); break;
+                case 3: analysis.external = analyze_external<string>(data_type); break;
+                case 4: analysis.external = analyze_external<bool>(data_type); break;
+                // string_view :    ,   
+                //    string
+            }
+
             all_results.push_back(analysis);
         }
 
@@ -1847,6 +7104,8 @@ int main() {
     SetConsoleOutputCP(65001);
 
     int num_arrays, num_points, num_threads;
+    long long external_elements;
+    int external_memory_mb = 0;
 
     cout << "=== COMPREHENSIVE SORTING ALGORITHMS ANALYSIS ===\n\n";
 
@@ -1857,12 +7116,23 @@ int main() {
     cin >> num_points;
     cout << "Enter number of threads: ";
     cin >> num_threads;
+    cout << "Enter external sort size in elements (0 to skip): ";
+    cin >> external_elements;
+    if (external_elements > 0) {
+        cout << "Enter external sort memory limit (MB): ";
+        cin >> external_memory_mb;
+    }
 
     if (num_arrays <= 0 || num_points <= 0 || num_threads <= 0) {
         cout << "Error: values must be positive!" << endl;
         return 1;
     }
 
+    if (external_elements < 0 || (external_elements > 0 && external_memory_mb <= 0)) {
+        cout << "Error: external sort size must be non-negative and memory limit positive!" << endl;
+        return 1;
+    }
+
     if (num_points > num_arrays) {
         cout << "Warning: number of points exceeds number of arrays. Using " << num_arrays << " points.\n";
         num_points = num_arrays;
@@ -1882,17 +7152,33 @@ int main() {
     cout << "* Number of sizes: " << num_arrays << " (" << test_sizes[0] << " - " << test_sizes.back() << " elements)\n";
     cout << "* Number of points: " << num_points << "\n";
     cout << "* Number of threads: " << num_threads << "\n";
-    cout << "* Data types: 5 (int, double, float, string, bool)\n";
+    cout << "* Data types: 6 (int, double, float, string, bool, string_view)\n";
     cout << "* Distributions: 5\n";
-    cout << "* Algorithms: 7\n";
-    cout << "* Total measurements: " << num_arrays * 5 * 5 * 7 << endl;
+    ComprehensiveAnalyzer analyzer(test_sizes, num_threads);
+    analyzer.set_external_sort(external_elements, static_cast<size_t>(external_memory_mb) * 1024 * 1024);
+    int num_algorithms = analyzer.get_algorithm_count();
+
+    cout << "* Algorithms: " << num_algorithms << "\n";
+    cout << "* Total measurements: " << num_arrays * 6 * 5 * num_algorithms << endl;
+    cout << "* Scaling: 1-" << num_threads << " threads on " << SCALING_ARRAY_SIZE << " elements\n";
+    cout << "* Parallel sorts in the main table (2+ threads): Quick > " << PARALLEL_QUICK_GRAIN
+         << ", Merge > " << PARALLEL_MERGE_GRAIN << ", Sample > " << SAMPLE_SORT_GRAIN
+         << ", Radix > " << PARALLEL_RADIX_GRAIN << " elements\n";
+    if (external_elements > 0) {
+        cout << "* External sort: " << external_elements << " elements, " << external_memory_mb << " MB memory\n";
+    }
+    cout << "* Selection: k/n sweep on " << SELECTION_ARRAY_SIZE << " elements\n";
+    cout << "* Small sizes: 2-" << SORTING_NETWORK_MAX << " elements, " << SMALL_SORT_BATCH << " arrays per size\n";
+    cout << "* K-way merge: k = " << KWAY_MERGE_FAN_INS.front() << "-" << KWAY_MERGE_FAN_INS.back()
+         << ", runs of " << KWAY_MERGE_RUN_LENGTHS.front() << "-" << KWAY_MERGE_RUN_LENGTHS.back() << " elements\n";
+    cout << "* Presortedness probe: " << PRESORTEDNESS_TRIALS << " trials per distribution on "
+         << PRESORTEDNESS_ARRAY_SIZES.front() << " - " << PRESORTEDNESS_ARRAY_SIZES.back() << " elements\n";
 
     cout << "\nStarting comprehensive analysis...\n";
 
     auto start_time = chrono::steady_clock::now();
 
     //  
-    ComprehensiveAnalyzer analyzer(test_sizes, num_threads);
     auto results = analyzer.run_comprehensive_analysis();
 
     auto end_time = chrono::steady_clock::now();
@@ -1910,9 +7196,23 @@ int main() {
         cout << "Warning: Failed to save results to file.\n";
     }
 
+    char choice;
+
+    //    auto_sort:      
+    cout << "\nSave winners as the built-in auto-sort table (auto_sort_table.inc)? (y/n): ";
+    cin >> choice;
+
+    if (choice == 'y' || choice == 'Y') {
+        AutoSorter auto_sorter(num_threads, {});
+        auto_sorter.add_results(results);
+        if (auto_sorter.save_table("auto_sort_table.inc")) {
+            cout << "Auto-sort table saved to: auto_sort_table.inc (" << auto_sorter.size()
+                 << " entries). Replace the one next to main.cpp to build it into auto_sort().\n";
+        }
+    }
+
     //    
     cout << "\nDo you want to view results now? (y/n): ";
-    char choice;
     cin >> choice;
 
     if (choice == 'y' || choice == 'Y') {